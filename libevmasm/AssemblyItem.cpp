@@ -28,6 +28,7 @@
 #include <libsolutil/FixedHash.h>
 #include <liblangutil/SourceLocation.h>
 
+#include <charconv>
 #include <fstream>
 #include <limits>
 
@@ -545,6 +546,20 @@ std::string AssemblyItem::computeSourceMapping(
 )
 {
 	std::string ret;
+	// Most items repeat all fields of their predecessor, i.e. need a single character.
+	ret.reserve(_items.size() * 2);
+
+	auto appendNumber = [&](int _value) {
+		char buffer[std::numeric_limits<int>::digits10 + 2];
+		auto const [end, errorCode] = std::to_chars(std::begin(buffer), std::end(buffer), _value);
+		solAssert(errorCode == std::errc{});
+		ret.append(buffer, end);
+	};
+
+	// Consecutive items usually share the same source name object,
+	// so the index is only looked up when it changes.
+	std::string const* prevSourceName = nullptr;
+	int prevSourceNameIndex = -1;
 
 	int prevStart = -1;
 	int prevLength = -1;
@@ -555,14 +570,17 @@ std::string AssemblyItem::computeSourceMapping(
 	for (auto const& item: _items)
 	{
 		if (!ret.empty())
-			ret += ";";
+			ret += ';';
 
 		SourceLocation const& location = item.location();
 		int length = location.start != -1 && location.end != -1 ? location.end - location.start : -1;
-		int sourceIndex =
-			(location.sourceName && _sourceIndicesMap.count(*location.sourceName)) ?
-			static_cast<int>(_sourceIndicesMap.at(*location.sourceName)) :
-			-1;
+		if (location.sourceName.get() != prevSourceName)
+		{
+			prevSourceName = location.sourceName.get();
+			auto it = prevSourceName ? _sourceIndicesMap.find(*prevSourceName) : _sourceIndicesMap.end();
+			prevSourceNameIndex = it != _sourceIndicesMap.end() ? static_cast<int>(it->second) : -1;
+		}
+		int sourceIndex = prevSourceNameIndex;
 		char jump = '-';
 		if (item.getJumpType() == evmasm::AssemblyItem::JumpType::IntoFunction || item.type() == CallF || item.type() == JumpF)
 			jump = 'i';
@@ -593,17 +611,17 @@ std::string AssemblyItem::computeSourceMapping(
 		if (components-- > 0)
 		{
 			if (location.start != prevStart)
-				ret += std::to_string(location.start);
+				appendNumber(location.start);
 			if (components-- > 0)
 			{
 				ret += ':';
 				if (length != prevLength)
-					ret += std::to_string(length);
+					appendNumber(length);
 				if (components-- > 0)
 				{
 					ret += ':';
 					if (sourceIndex != prevSourceIndex)
-						ret += std::to_string(sourceIndex);
+						appendNumber(sourceIndex);
 					if (components-- > 0)
 					{
 						ret += ':';
@@ -613,7 +631,7 @@ std::string AssemblyItem::computeSourceMapping(
 						{
 							ret += ':';
 							if (modifierDepth != prevModifierDepth)
-								ret += std::to_string(modifierDepth);
+								appendNumber(modifierDepth);
 						}
 					}
 				}
@@ -621,7 +639,7 @@ std::string AssemblyItem::computeSourceMapping(
 		}
 
 		if (item.opcodeCount() > 1)
-			ret += std::string(item.opcodeCount() - 1, ';');
+			ret.append(item.opcodeCount() - 1, ';');
 
 		prevStart = location.start;
 		prevLength = length;
@@ -23,7 +23,13 @@
 
 #include <libevmasm/Instruction.h>
 #include <libsolutil/CommonData.h>
+#include <array>
 #include <functional>
+#include <map>
+#include <optional>
+#include <vector>
+
+#include <range/v3/view/map.hpp>
 
 namespace solidity::evmasm
 {
@@ -51,6 +57,133 @@ struct SimplificationRule
 	std::function<bool()> feasible;
 };
 
+/**
+ * Description of the root of an argument of an expression, as far as it is relevant
+ * to the selection of candidate rules in a @a SimplificationRuleIndex.
+ */
+struct SimplificationRuleArgument
+{
+	enum class Kind
+	{
+		Constant,
+		Operation,
+		Other
+	};
+
+	Kind kind = Kind::Other;
+	Instruction instruction = Instruction::STOP; ///< Only valid if kind is Operation
+};
+
+/**
+ * Simplification rules arranged in a decision tree: The rules are selected by the instruction
+ * at the root of their patterns first and by the first argument of their patterns next.
+ * The remaining arguments are compared before the full (and much more expensive) pattern matching
+ * is done, so that it only runs for rules that can possibly match.
+ *
+ * The order in which the rules were added is preserved, i.e. the first candidate that matches
+ * is the first rule that matches.
+ */
+template <class Pattern>
+class SimplificationRuleIndex
+{
+public:
+	using Rule = SimplificationRule<Pattern>;
+	using Argument = SimplificationRuleArgument;
+
+	/// Adds a rule for expressions that have @a _instruction at their root.
+	/// @param _arguments the arguments required by the pattern of the rule, where nullopt
+	/// means that the pattern accepts any argument at that position.
+	void addRule(Instruction _instruction, Rule _rule, std::vector<std::optional<Argument>> _arguments)
+	{
+		Node& node = m_nodes[static_cast<uint8_t>(_instruction)];
+		size_t index = node.rules.size();
+		std::optional<Argument> firstArgument = _arguments.empty() ? std::nullopt : _arguments.front();
+		node.rules.push_back({std::move(_rule), std::move(_arguments)});
+
+		if (!firstArgument)
+		{
+			node.anyFirstArgumentCandidates.push_back(index);
+			for (auto& candidates: node.candidatesByFirstArgument | ranges::views::values)
+				candidates.push_back(index);
+		}
+		else
+		{
+			auto [it, inserted] = node.candidatesByFirstArgument.try_emplace(key(*firstArgument));
+			if (inserted)
+				it->second = node.anyFirstArgumentCandidates;
+			it->second.push_back(index);
+		}
+	}
+
+	/// @returns true if there are no rules for expressions with @a _instruction at their root.
+	bool empty(Instruction _instruction) const { return m_nodes[static_cast<uint8_t>(_instruction)].rules.empty(); }
+
+	/// Calls @a _matches for the candidate rules for an expression with @a _instruction at its
+	/// root and arguments described by @a _arguments.
+	/// @returns the first rule for which it returns true or nullptr if there is none.
+	template <typename Matches>
+	Rule const* findFirst(Instruction _instruction, std::vector<Argument> const& _arguments, Matches&& _matches) const
+	{
+		Node const& node = m_nodes[static_cast<uint8_t>(_instruction)];
+		std::vector<size_t> const* candidates = &node.anyFirstArgumentCandidates;
+		if (!_arguments.empty())
+			if (auto it = node.candidatesByFirstArgument.find(key(_arguments.front())); it != node.candidatesByFirstArgument.end())
+				candidates = &it->second;
+
+		for (size_t index: *candidates)
+		{
+			Entry const& entry = node.rules[index];
+			bool candidate = true;
+			for (size_t i = 1; candidate && i < entry.arguments.size() && i < _arguments.size(); ++i)
+				candidate = accepts(entry.arguments[i], _arguments[i]);
+			if (candidate && _matches(entry.rule))
+				return &entry.rule;
+		}
+		return nullptr;
+	}
+
+private:
+	struct Entry
+	{
+		Rule rule;
+		std::vector<std::optional<Argument>> arguments;
+	};
+
+	struct Node
+	{
+		std::vector<Entry> rules;
+		/// Indices of the rules whose first argument accepts an argument with the given key, in order.
+		std::map<uint16_t, std::vector<size_t>> candidatesByFirstArgument;
+		/// Indices of the rules that accept any first argument, in order.
+		std::vector<size_t> anyFirstArgumentCandidates;
+	};
+
+	static uint16_t key(Argument const& _argument)
+	{
+		switch (_argument.kind)
+		{
+		case Argument::Kind::Operation:
+			return static_cast<uint8_t>(_argument.instruction);
+		case Argument::Kind::Constant:
+			return 0x100;
+		case Argument::Kind::Other:
+			break;
+		}
+		return 0x101;
+	}
+
+	static bool accepts(std::optional<Argument> const& _required, Argument const& _argument)
+	{
+		if (!_required)
+			return true;
+		if (_required->kind != _argument.kind)
+			return false;
+		return _required->kind != Argument::Kind::Operation || _required->instruction == _argument.instruction;
+	}
+
+	std::array<Node, 256> m_nodes;
+};
+
 template <typename Pattern>
 struct EVMBuiltins
 {
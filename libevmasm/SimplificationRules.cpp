@@ -41,23 +41,37 @@ SimplificationRule<Pattern> const* Rules::findFirstMatch(
 	ExpressionClasses const& _classes
 )
 {
-	resetMatchGroups();
-
 	assertThrow(_expr.item, OptimizerException, "");
-	for (auto const& rule: m_rules[uint8_t(_expr.item->instruction())])
+	Instruction instruction = _expr.item->instruction();
+	if (m_rules.empty(instruction))
+		return nullptr;
+
+	std::vector<SimplificationRuleArgument> arguments;
+	arguments.reserve(_expr.arguments.size());
+	for (ExpressionClasses::Id argument: _expr.arguments)
 	{
-		if (rule.pattern.matches(_expr, _classes))
-			if (!rule.feasible || rule.feasible())
-				return &rule;
+		SimplificationRuleArgument& description = arguments.emplace_back();
+		if (AssemblyItem const* item = _classes.representative(argument).item)
+		{
+			if (item->type() == Operation)
+			{
+				description.kind = SimplificationRuleArgument::Kind::Operation;
+				description.instruction = item->instruction();
+			}
+			else if (item->type() == Push)
+				description.kind = SimplificationRuleArgument::Kind::Constant;
+		}
+	}
 
+	return m_rules.findFirst(instruction, arguments, [&](SimplificationRule<Pattern> const& _rule) {
 		resetMatchGroups();
-	}
-	return nullptr;
+		return _rule.pattern.matches(_expr, _classes) && (!_rule.feasible || _rule.feasible());
+	});
 }
 
 bool Rules::isInitialized() const
 {
-	return !m_rules[uint8_t(Instruction::ADD)].empty();
+	return !m_rules.empty(Instruction::ADD);
 }
 
 void Rules::addRules(std::vector<SimplificationRule<Pattern>> const& _rules)
@@ -68,7 +82,15 @@ void Rules::addRules(std::vector<SimplificationRule<Pattern>> const& _rules)
 
 void Rules::addRule(SimplificationRule<Pattern> const& _rule)
 {
-	m_rules[uint8_t(_rule.pattern.instruction())].push_back(_rule);
+	std::vector<std::optional<SimplificationRuleArgument>> arguments;
+	for (Pattern const& argument: _rule.pattern.arguments())
+		if (argument.type() == Operation)
+			arguments.emplace_back(SimplificationRuleArgument{SimplificationRuleArgument::Kind::Operation, argument.instruction()});
+		else if (argument.type() == Push)
+			arguments.emplace_back(SimplificationRuleArgument{SimplificationRuleArgument::Kind::Constant});
+		else
+			arguments.emplace_back(std::nullopt);
+	m_rules.addRule(_rule.pattern.instruction(), _rule, std::move(arguments));
 }
 
 Rules::Rules()
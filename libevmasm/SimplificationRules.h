@@ -76,7 +76,7 @@ private:
 	std::map<unsigned, Expression const*> m_matchGroups;
 	/// Pattern to match, replacement to be applied and flag indicating whether
 	/// the replacement might remove some elements (except constants).
-	std::vector<SimplificationRule<Pattern>> m_rules[256];
+	SimplificationRuleIndex<Pattern> m_rules;
 };
 
 /**
@@ -51,6 +51,9 @@
 #include <liblangutil/CharStream.h>
 #include <liblangutil/Exceptions.h>
 
+#include <algorithm>
+#include <iterator>
+
 using namespace solidity;
 using namespace solidity::langutil;
 
@@ -102,18 +105,25 @@ std::string CharStream::lineAtPosition(int _position) const
 LineColumn CharStream::translatePositionToLineColumn(int _position) const
 {
 	using size_type = std::string::size_type;
-	using diff_type = std::string::difference_type;
 	size_type searchPosition = std::min<size_type>(m_source.size(), size_type(_position));
-	int lineNumber = static_cast<int>(count(m_source.begin(), m_source.begin() + diff_type(searchPosition), '\n'));
-	size_type lineStart;
-	if (searchPosition == 0)
-		lineStart = 0;
-	else
+	std::vector<size_t> const& starts = lineStarts();
+	// The line containing the position is the last one that starts at or before it.
+	auto line = std::prev(std::upper_bound(starts.begin(), starts.end(), searchPosition));
+	return LineColumn{
+		static_cast<int>(line - starts.begin()),
+		static_cast<int>(searchPosition - *line)
+	};
+}
+
+std::vector<size_t> const& CharStream::lineStarts() const
+{
+	if (m_lineStarts.empty())
 	{
-		lineStart = m_source.rfind('\n', searchPosition - 1);
-		lineStart = lineStart == std::string::npos ? 0 : lineStart + 1;
+		m_lineStarts.push_back(0);
+		for (size_t i = m_source.find('\n'); i != std::string::npos; i = m_source.find('\n', i + 1))
+			m_lineStarts.push_back(i + 1);
 	}
-	return LineColumn{lineNumber, static_cast<int>(searchPosition - lineStart)};
+	return m_lineStarts;
 }
 
 std::string_view CharStream::text(SourceLocation const& _location) const
@@ -146,7 +156,20 @@ std::string CharStream::singleLineSnippet(std::string const& _sourceCode, Source
 
 std::optional<int> CharStream::translateLineColumnToPosition(LineColumn const& _lineColumn) const
 {
-	return translateLineColumnToPosition(m_source, _lineColumn);
+	std::vector<size_t> const& starts = lineStarts();
+	if (
+		_lineColumn.line < 0 ||
+		_lineColumn.column < 0 ||
+		static_cast<size_t>(_lineColumn.line) >= starts.size()
+	)
+		return std::nullopt;
+
+	size_t const line = static_cast<size_t>(_lineColumn.line);
+	size_t const offset = starts[line];
+	size_t const endOfLine = line + 1 < starts.size() ? starts[line + 1] - 1 : m_source.size();
+	if (offset + static_cast<size_t>(_lineColumn.column) > endOfLine)
+		return std::nullopt;
+	return offset + static_cast<size_t>(_lineColumn.column);
 }
 
 std::optional<int> CharStream::translateLineColumnToPosition(std::string const& _text, LineColumn const& _input)
@@ -55,6 +55,7 @@
 #include <string>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 namespace solidity::langutil
 {
@@ -103,12 +104,13 @@ public:
 	///@{
 	///@name Error printing helper functions
 	/// Functions that help pretty-printing parse errors
-	/// Do only use in error cases, they are quite expensive.
 	std::string lineAtPosition(int _position) const;
+	/// Translates an absolute position to line:column in logarithmic time, using an index
+	/// of line starts that is built on first use. The first call is not thread-safe.
 	LineColumn translatePositionToLineColumn(int _position) const;
 	///@}
 
-	/// Translates a line:column to the absolute position.
+	/// Translates a line:column to the absolute position, using the same index as translatePositionToLineColumn().
 	std::optional<int> translateLineColumnToPosition(LineColumn const& _lineColumn) const;
 
 	/// Translates a line:column to the absolute position for the given input text.
@@ -142,10 +144,15 @@ public:
 	static std::string singleLineSnippet(std::string const& _sourceCode, SourceLocation const& _location);
 
 private:
+	/// @returns the offsets at which the lines of the source start, building them if necessary.
+	std::vector<size_t> const& lineStarts() const;
+
 	std::string m_source;
 	std::string m_name;
 	bool m_importedFromAST{false};
 	size_t m_position{0};
+	/// Lazily computed offsets of the first character of each line. Empty if not computed yet.
+	mutable std::vector<size_t> m_lineStarts;
 };
 
 }
@@ -143,6 +143,13 @@ void ErrorReporter::fatalError(ErrorId _error, Error::Type _type, SourceLocation
 	solThrow(FatalError, _description);
 }
 
+void ErrorReporter::merge(ErrorList const& _errorList)
+{
+	for (auto const& error: _errorList)
+		if (!checkForExcessiveErrors(error->type()))
+			m_errorList.push_back(error);
+}
+
 ErrorList const& ErrorReporter::errors() const
 {
 	return m_errorList;
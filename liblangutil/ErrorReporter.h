@@ -53,6 +53,11 @@ public:
 		m_errorList += _errorList;
 	}
 
+	/// Reports the errors from @a _errorList (e.g. collected by another reporter) in order,
+	/// subject to the same limits as if they had been reported through this reporter.
+	/// Throws FatalError if the number of errors becomes excessive.
+	void merge(ErrorList const& _errorList);
+
 	void warning(ErrorId _error, std::string const& _description);
 
 	void warning(ErrorId _error, SourceLocation const& _location, std::string const& _description);
@@ -21,6 +21,7 @@
 #include <libsmtutil/SMTLib2Parser.h>
 
 #include <libsolutil/Keccak256.h>
+#include <libsolutil/Parallel.h>
 #include <libsolutil/StringUtils.h>
 #include <libsolutil/Visitor.h>
 
@@ -95,24 +96,7 @@ CHCSolverInterface::QueryResult CHCSmtLib2Interface::query(Expression const& _bl
 	std::string query = dumpQuery(_block);
 	try
 	{
-		std::string response = querySolver(query);
-
-		CheckResult result;
-		// NOTE: Our internal semantics is UNSAT -> SAFE and SAT -> UNSAFE, which corresponds to usual SMT-based model checking
-		// However, with CHC solvers, the meaning is flipped, UNSAT -> UNSAFE and SAT -> SAFE.
-		// So we have to flip the answer.
-		if (boost::starts_with(response, "sat"))
-		{
-			auto maybeInvariants = invariantsFromSolverResponse(response);
-			return {CheckResult::UNSATISFIABLE, maybeInvariants.value_or(Expression(true)), {}};
-		}
-		else if (boost::starts_with(response, "unsat"))
-			result = CheckResult::SATISFIABLE;
-		else if (boost::starts_with(response, "unknown"))
-			result = CheckResult::UNKNOWN;
-		else
-			result = CheckResult::ERROR;
-		return {result, Expression(true), {}};
+		return resultFromResponse(querySolver(query));
 	}
 	catch(smtutil::SMTSolverInteractionError const&)
 	{
@@ -121,6 +105,43 @@ CHCSolverInterface::QueryResult CHCSmtLib2Interface::query(Expression const& _bl
 
 }
 
+std::vector<CHCSolverInterface::QueryResult> CHCSmtLib2Interface::batchQuery(std::vector<Expression> const& _blocks, unsigned _workers)
+{
+	std::string const& rules = m_commands.toString();
+	auto queries = applyMap(_blocks, [&](Expression const& _block) { return dumpQuery(rules, _block); });
+	std::vector<QueryResult> results;
+	for (auto const& response: querySolver(queries, _workers))
+		try
+		{
+			results.emplace_back(resultFromResponse(response));
+		}
+		catch(smtutil::SMTSolverInteractionError const&)
+		{
+			results.push_back({CheckResult::ERROR, Expression(true), {}});
+		}
+	return results;
+}
+
+CHCSolverInterface::QueryResult CHCSmtLib2Interface::resultFromResponse(std::string const& _response) const
+{
+	CheckResult result;
+	// NOTE: Our internal semantics is UNSAT -> SAFE and SAT -> UNSAFE, which corresponds to usual SMT-based model checking
+	// However, with CHC solvers, the meaning is flipped, UNSAT -> UNSAFE and SAT -> SAFE.
+	// So we have to flip the answer.
+	if (boost::starts_with(_response, "sat"))
+	{
+		auto maybeInvariants = invariantsFromSolverResponse(_response);
+		return {CheckResult::UNSATISFIABLE, maybeInvariants.value_or(Expression(true)), {}};
+	}
+	else if (boost::starts_with(_response, "unsat"))
+		result = CheckResult::SATISFIABLE;
+	else if (boost::starts_with(_response, "unknown"))
+		result = CheckResult::UNKNOWN;
+	else
+		result = CheckResult::ERROR;
+	return {result, Expression(true), {}};
+}
+
 void CHCSmtLib2Interface::declareVariable(std::string const& _name, SortPointer const& _sort)
 {
 	smtAssert(_sort);
@@ -187,9 +208,45 @@ std::string CHCSmtLib2Interface::querySolver(std::string const& _input)
 	return "unknown\n";
 }
 
+std::vector<std::string> CHCSmtLib2Interface::querySolver(std::vector<std::string> const& _inputs, unsigned _workers)
+{
+	std::vector<std::optional<std::string>> responses(_inputs.size());
+	std::vector<size_t> pending;
+	for (size_t i = 0; i < _inputs.size(); ++i)
+		if (auto it = m_queryResponses.find(util::keccak256(_inputs[i])); it != m_queryResponses.end())
+			responses[i] = it->second;
+		else
+			pending.push_back(i);
+
+	// Only the callback invocations run concurrently, all bookkeeping happens on this thread.
+	if (m_smtCallback)
+		parallelFor(pending.size(), _workers, [&](size_t _index) {
+			size_t i = pending[_index];
+			auto result = m_smtCallback(ReadCallback::kindString(ReadCallback::Kind::SMTQuery), _inputs[i]);
+			if (result.success)
+				responses[i] = std::move(result.responseOrErrorMessage);
+		});
+
+	std::vector<std::string> results;
+	for (size_t i = 0; i < _inputs.size(); ++i)
+		if (responses[i])
+			results.emplace_back(std::move(*responses[i]));
+		else
+		{
+			m_unhandledQueries.push_back(_inputs[i]);
+			results.emplace_back("unknown\n");
+		}
+	return results;
+}
+
 std::string CHCSmtLib2Interface::dumpQuery(Expression const& _expr)
 {
-	return m_commands.toString() + createQueryAssertion(_expr.name) + '\n' + "(check-sat)" + '\n';
+	return dumpQuery(m_commands.toString(), _expr);
+}
+
+std::string CHCSmtLib2Interface::dumpQuery(std::string const& _rules, Expression const& _expr)
+{
+	return _rules + createQueryAssertion(_expr.name) + '\n' + "(check-sat)" + '\n';
 }
 
 void CHCSmtLib2Interface::createHeader()
@@ -49,6 +49,11 @@ public:
 	/// @returns solving result, an invariant, and counterexample graph, if possible.
 	QueryResult query(Expression const& _expr) override;
 
+	/// Serializes the rules only once and sends one query per element of @a _exprs to the solver,
+	/// with up to @a _workers solver invocations running concurrently.
+	/// The SMT callback must be safe to call from multiple threads if @a _workers is greater than one.
+	std::vector<QueryResult> batchQuery(std::vector<Expression> const& _exprs, unsigned _workers) override;
+
 	void declareVariable(std::string const& _name, SortPointer const& _sort) override;
 
 	std::string dumpQuery(Expression const& _expr);
@@ -89,11 +94,20 @@ protected:
 	std::string forall(Expression const& _expr);
 
 	static std::string createQueryAssertion(std::string _name);
+	/// @returns the query checking reachability of @a _expr, given the rules serialized in @a _rules.
+	static std::string dumpQuery(std::string const& _rules, Expression const& _expr);
 	void createHeader();
 
 	/// Communicates with the solver via the callback. Throws SMTSolverError on error.
 	virtual std::string querySolver(std::string const& _input);
 
+	/// Same as querySolver, but for multiple inputs, of which up to @a _workers are solved concurrently.
+	/// @returns the responses in the order of @a _inputs.
+	virtual std::vector<std::string> querySolver(std::vector<std::string> const& _inputs, unsigned _workers);
+
+	/// Translates the solver's response to a query into a result, flipping the answer from CHC to SMT semantics.
+	QueryResult resultFromResponse(std::string const& _response) const;
+
 	/// Translates CHC solver response with a model to our representation of invariants. Returns None on error.
 	std::optional<smtutil::Expression> invariantsFromSolverResponse(std::string const& _response) const;
 
@@ -59,6 +59,17 @@ public:
 	/// @returns solving result, an invariant, and counterexample graph, if possible.
 	virtual QueryResult query(Expression const& _expr) = 0;
 
+	/// Checks reachability of each of the function applications in @a _exprs against the same set of rules.
+	/// Implementations may run up to @a _workers of these queries concurrently.
+	/// @returns one result per element of @a _exprs, in the same order.
+	virtual std::vector<QueryResult> batchQuery(std::vector<Expression> const& _exprs, unsigned /*_workers*/)
+	{
+		std::vector<QueryResult> results;
+		for (auto const& expr: _exprs)
+			results.emplace_back(query(expr));
+		return results;
+	}
+
 protected:
 	std::optional<unsigned> m_queryTimeout;
 };
@@ -213,21 +213,30 @@ std::string SMTLib2Context::toSmtLibSort(solidity::smtutil::SortPointer const& _
 }
 
 std::string SMTLib2Context::toSExpr(Expression const& _expr)
+{
+	std::string sexpr;
+	appendSExpr(_expr, sexpr);
+	return sexpr;
+}
+
+void SMTLib2Context::appendSExpr(Expression const& _expr, std::string& _sexpr)
 {
 	if (_expr.arguments.empty())
-		return _expr.name;
+	{
+		_sexpr += _expr.name;
+		return;
+	}
 
-	std::string sexpr = "(";
 	if (_expr.name == "int2bv")
 	{
 		size_t size = std::stoul(_expr.arguments[1].name);
 		auto arg = toSExpr(_expr.arguments.front());
 		auto int2bv = "(_ int2bv " + std::to_string(size) + ")";
 		// Some solvers treat all BVs as unsigned, so we need to manually apply 2's complement if needed.
-		sexpr += std::string("ite ") +
+		_sexpr += std::string("(ite ") +
 			"(>= " + arg + " 0) " +
 			"(" + int2bv + " " + arg + ") " +
-			"(bvneg (" + int2bv + " (- " + arg + ")))";
+			"(bvneg (" + int2bv + " (- " + arg + "))))";
 	}
 	else if (_expr.name == "bv2int")
 	{
@@ -238,7 +247,10 @@ std::string SMTLib2Context::toSExpr(Expression const& _expr)
 		auto nat = "(bv2nat " + arg + ")";
 
 		if (!intSort->isSigned)
-			return nat;
+		{
+			_sexpr += nat;
+			return;
+		}
 
 		auto bvSort = std::dynamic_pointer_cast<BitVectorSort>(_expr.arguments.front().sort);
 		smtAssert(bvSort, "");
@@ -246,10 +258,10 @@ std::string SMTLib2Context::toSExpr(Expression const& _expr)
 		auto pos = std::to_string(bvSort->size - 1);
 
 		// Some solvers treat all BVs as unsigned, so we need to manually apply 2's complement if needed.
-		sexpr += std::string("ite ") +
+		_sexpr += std::string("(ite ") +
 			"(= ((_ extract " + pos + " " + pos + ")" + arg + ") #b0) " +
 			nat + " " +
-			"(- (bv2nat (bvneg " + arg + ")))";
+			"(- (bv2nat (bvneg " + arg + "))))";
 	}
 	else if (_expr.name == "const_array")
 	{
@@ -258,8 +270,9 @@ std::string SMTLib2Context::toSExpr(Expression const& _expr)
 		smtAssert(sortSort, "");
 		auto arraySort = std::dynamic_pointer_cast<ArraySort>(sortSort->inner);
 		smtAssert(arraySort, "");
-		sexpr += "(as const " + toSmtLibSort(arraySort) + ") ";
-		sexpr += toSExpr(_expr.arguments.at(1));
+		_sexpr += "((as const " + toSmtLibSort(arraySort) + ") ";
+		appendSExpr(_expr.arguments.at(1), _sexpr);
+		_sexpr += ')';
 	}
 	else if (_expr.name == "tuple_get")
 	{
@@ -267,24 +280,33 @@ std::string SMTLib2Context::toSExpr(Expression const& _expr)
 		auto tupleSort = std::dynamic_pointer_cast<TupleSort>(_expr.arguments.at(0).sort);
 		size_t index = std::stoul(_expr.arguments.at(1).name);
 		smtAssert(index < tupleSort->members.size(), "");
-		sexpr += "|" + tupleSort->members.at(index) + "| " + toSExpr(_expr.arguments.at(0));
+		_sexpr += "(|" + tupleSort->members.at(index) + "| ";
+		appendSExpr(_expr.arguments.at(0), _sexpr);
+		_sexpr += ')';
 	}
 	else if (_expr.name == "tuple_constructor")
 	{
 		auto tupleSort = std::dynamic_pointer_cast<TupleSort>(_expr.sort);
 		smtAssert(tupleSort, "");
-		sexpr += "|" + tupleSort->name + "|";
+		_sexpr += "(|" + tupleSort->name + "|";
 		for (auto const& arg: _expr.arguments)
-			sexpr += " " + toSExpr(arg);
+		{
+			_sexpr += ' ';
+			appendSExpr(arg, _sexpr);
+		}
+		_sexpr += ')';
 	}
 	else
 	{
-		sexpr += _expr.name;
+		_sexpr += '(';
+		_sexpr += _expr.name;
 		for (auto const& arg: _expr.arguments)
-			sexpr += " " + toSExpr(arg);
+		{
+			_sexpr += ' ';
+			appendSExpr(arg, _sexpr);
+		}
+		_sexpr += ')';
 	}
-	sexpr += ")";
-	return sexpr;
 }
 
 std::optional<SortPointer> SMTLib2Context::getTupleType(std::string const& _name) const
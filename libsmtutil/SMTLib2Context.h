@@ -88,6 +88,10 @@ public:
 
 	void setTupleDeclarationCallback(TupleDeclarationCallback _callback);
 private:
+	/// Appends the s-expression of @a _expr to @a _sexpr.
+	/// Writing into a single buffer avoids copying the text of every subexpression into each of its ancestors.
+	void appendSExpr(Expression const& _expr, std::string& _sexpr);
+
 	SortId resolveBitVectorSort(BitVectorSort const& _sort);
 	SortId resolveArraySort(ArraySort const& _sort);
 	SortId resolveTupleSort(TupleSort const& _sort);
@@ -244,15 +244,32 @@ void SMTLib2Commands::pop() {
 	m_frameLimits.pop_back();
 	while (m_commands.size() > limit)
 		m_commands.pop_back();
+	truncateText(limit);
 }
 
-std::string SMTLib2Commands::toString() const {
-	return boost::algorithm::join(m_commands, "\n");
+std::string const& SMTLib2Commands::toString() const {
+	for (std::size_t i = m_textEnds.size(); i < m_commands.size(); ++i)
+	{
+		if (i > 0)
+			m_text += '\n';
+		m_text += m_commands[i];
+		m_textEnds.push_back(m_text.size());
+	}
+	return m_text;
 }
 
 void SMTLib2Commands::clear() {
 	m_commands.clear();
 	m_frameLimits.clear();
+	truncateText(0);
+}
+
+void SMTLib2Commands::truncateText(std::size_t _commandCount)
+{
+	if (m_textEnds.size() <= _commandCount)
+		return;
+	m_textEnds.resize(_commandCount);
+	m_text.resize(m_textEnds.empty() ? 0 : m_textEnds.back());
 }
 
 void SMTLib2Commands::assertion(std::string _expr) {
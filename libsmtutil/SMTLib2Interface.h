@@ -58,11 +58,20 @@ public:
 		std::vector<std::string> const& _memberSorts
 	);
 
-	[[nodiscard]] std::string toString() const;
+	/// @returns all commands separated by newlines.
+	/// The text is built incrementally, so only commands added since the previous call are copied.
+	[[nodiscard]] std::string const& toString() const;
 private:
+	/// Drops the cached text of all commands after the first @a _commandCount ones.
+	void truncateText(std::size_t _commandCount);
+
 	std::vector<std::string> m_commands;
 	std::vector<std::size_t> m_frameLimits;
 
+	/// Text of the first m_textEnds.size() commands, as returned by toString().
+	mutable std::string m_text;
+	/// Position in m_text just after each of the commands it contains.
+	mutable std::vector<std::size_t> m_textEnds;
 };
 
 class SMTLib2Interface: public BMCSolverInterface
@@ -32,7 +32,6 @@
 #include <fmt/format.h>
 
 #include <range/v3/algorithm/find_if.hpp>
-#include <range/v3/view/reverse.hpp>
 
 using namespace solidity;
 using namespace solidity::langutil;
@@ -291,37 +290,8 @@ void ContractLevelChecker::findDuplicateDefinitions(std::map<std::string, std::v
 
 void ContractLevelChecker::checkAbstractDefinitions(ContractDefinition const& _contract)
 {
-	// Collects functions, static variable getters and modifiers. If they
-	// override (unimplemented) base class ones, they are replaced.
-	std::set<OverrideProxy, OverrideProxy::CompareBySignature> proxies;
-
-	auto registerProxy = [&proxies](OverrideProxy const& _overrideProxy)
-	{
-		// Overwrite an existing proxy, if it exists.
-		if (!_overrideProxy.unimplemented())
-			proxies.erase(_overrideProxy);
-
-		proxies.insert(_overrideProxy);
-	};
-
-	// Search from base to derived, collect all functions and modifiers and
-	// update proxies.
-	for (ContractDefinition const* contract: _contract.annotation().linearizedBaseContracts | ranges::views::reverse)
-	{
-		for (VariableDeclaration const* v: contract->stateVariables())
-			if (v->isPartOfExternalInterface())
-				registerProxy(OverrideProxy(v));
-
-		for (FunctionDefinition const* function: contract->definedFunctions())
-			if (!function->isConstructor())
-				registerProxy(OverrideProxy(function));
-
-		for (ModifierDefinition const* modifier: contract->functionModifiers())
-			registerProxy(OverrideProxy(modifier));
-	}
-
 	// Set to not fully implemented if at least one flag is false.
-	for (auto const& proxy: proxies)
+	for (auto const& proxy: implementationCandidates(_contract))
 		if (proxy.unimplemented())
 			_contract.annotation().unimplementedDeclarations->push_back(proxy.declaration());
 
@@ -355,6 +325,62 @@ void ContractLevelChecker::checkAbstractDefinitions(ContractDefinition const& _c
 	}
 }
 
+OverrideChecker::OverrideProxyBySignatureSet const& ContractLevelChecker::implementationCandidates(ContractDefinition const& _contract)
+{
+	if (auto it = m_implementationCandidates.find(&_contract); it != m_implementationCandidates.end())
+		return it->second;
+
+	std::vector<ContractDefinition const*> const& bases = _contract.annotation().linearizedBaseContracts;
+	solAssert(bases.empty() || bases.front() == &_contract);
+
+	// Start from the candidates of the first base whose linearization is a suffix of the one of
+	// this contract, since they are the result of processing that very suffix.
+	// This is always the case for the direct base under single inheritance.
+	OverrideChecker::OverrideProxyBySignatureSet proxies;
+	size_t processedFrom = bases.size();
+	for (size_t i = 1; i < bases.size(); ++i)
+		if (std::equal(
+			bases.begin() + static_cast<ptrdiff_t>(i),
+			bases.end(),
+			bases[i]->annotation().linearizedBaseContracts.begin(),
+			bases[i]->annotation().linearizedBaseContracts.end()
+		))
+		{
+			proxies = implementationCandidates(*bases[i]);
+			processedFrom = i;
+			break;
+		}
+
+	auto registerProxy = [&proxies](OverrideProxy const& _overrideProxy)
+	{
+		// Overwrite an existing proxy, if it exists.
+		if (!_overrideProxy.unimplemented())
+			proxies.erase(_overrideProxy);
+
+		proxies.insert(_overrideProxy);
+	};
+
+	// Search from base to derived, collect all functions and modifiers and
+	// update proxies.
+	for (size_t i = processedFrom; i > 0; --i)
+	{
+		ContractDefinition const* contract = bases[i - 1];
+
+		for (VariableDeclaration const* v: contract->stateVariables())
+			if (v->isPartOfExternalInterface())
+				registerProxy(OverrideProxy(v));
+
+		for (FunctionDefinition const* function: contract->definedFunctions())
+			if (!function->isConstructor())
+				registerProxy(OverrideProxy(function));
+
+		for (ModifierDefinition const* modifier: contract->functionModifiers())
+			registerProxy(OverrideProxy(modifier));
+	}
+
+	return m_implementationCandidates.emplace(&_contract, std::move(proxies)).first->second;
+}
+
 
 void ContractLevelChecker::checkBaseConstructorArguments(ContractDefinition const& _contract)
 {
@@ -68,6 +68,10 @@ private:
 	void findDuplicateDefinitions(std::map<std::string, std::vector<T>> const& _definitions);
 	/// Checks for unimplemented functions and modifiers.
 	void checkAbstractDefinitions(ContractDefinition const& _contract);
+	/// @returns the functions, public state variables and modifiers of the contract and its bases,
+	/// one per signature, where implemented ones replace those defined in less derived contracts.
+	/// Reuses the result for a base contract whenever its linearization is a suffix of the one of @a _contract.
+	OverrideChecker::OverrideProxyBySignatureSet const& implementationCandidates(ContractDefinition const& _contract);
 	/// Checks that the base constructor arguments are properly provided.
 	/// Fills the list of unimplemented functions in _contract's annotations.
 	void checkBaseConstructorArguments(ContractDefinition const& _contract);
@@ -95,6 +99,8 @@ private:
 
 	OverrideChecker m_overrideChecker;
 	langutil::ErrorReporter& m_errorReporter;
+	/// Cache for implementationCandidates().
+	std::map<ContractDefinition const*, OverrideChecker::OverrideProxyBySignatureSet> m_implementationCandidates;
 };
 
 }
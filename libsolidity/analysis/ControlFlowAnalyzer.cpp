@@ -20,6 +20,7 @@
 
 #include <liblangutil/SourceLocation.h>
 #include <libsolutil/Algorithms.h>
+#include <libsolutil/Parallel.h>
 
 #include <range/v3/algorithm/sort.hpp>
 
@@ -32,17 +33,37 @@ using namespace solidity::frontend;
 
 bool ControlFlowAnalyzer::run()
 {
-	for (auto& [pair, flow]: m_cfg.allFunctionFlows())
-		analyze(*pair.function, pair.contract, *flow);
+	std::vector<std::pair<CFG::FunctionContractTuple, FunctionFlow const*>> flows;
+	for (auto const& [pair, flow]: m_cfg.allFunctionFlows())
+		if (pair.function->isImplemented())
+			flows.emplace_back(pair, flow.get());
+
+	std::vector<FunctionFindings> findings(flows.size());
+	util::parallelFor(flows.size(), m_workers, [&](size_t _index) {
+		findings[_index] = analyze(*flows[_index].second);
+	});
+
+	// Some warnings are only reported once, for the first function they are found in.
+	for (size_t i = 0; i < flows.size(); ++i)
+		report(*flows[i].first.function, flows[i].first.contract, findings[i]);
 
 	return !Error::containsErrors(m_errorReporter.errors());
 }
 
-void ControlFlowAnalyzer::analyze(FunctionDefinition const& _function, ContractDefinition const* _contract, FunctionFlow const& _flow)
+ControlFlowAnalyzer::FunctionFindings ControlFlowAnalyzer::analyze(FunctionFlow const& _flow)
 {
-	if (!_function.isImplemented())
-		return;
+	return {
+		uninitializedAccesses(_flow.entry, _flow.exit),
+		unreachableLocations(_flow.entry, _flow.exit, _flow.revert, _flow.transactionReturn)
+	};
+}
 
+void ControlFlowAnalyzer::report(
+	FunctionDefinition const& _function,
+	ContractDefinition const* _contract,
+	FunctionFindings const& _findings
+)
+{
 	std::optional<std::string> mostDerivedContractName;
 
 	// The name of the most derived contract only required if it differs from
@@ -50,17 +71,19 @@ void ControlFlowAnalyzer::analyze(FunctionDefinition const& _function, ContractD
 	if (_contract && _contract != _function.annotation().contract)
 		mostDerivedContractName = _contract->name();
 
-	checkUninitializedAccess(
-		_flow.entry,
-		_flow.exit,
+	reportUninitializedAccesses(
+		_findings.uninitializedAccesses,
 		_function.body().statements().empty(),
 		mostDerivedContractName
 	);
-	checkUnreachable(_flow.entry, _flow.exit, _flow.revert, _flow.transactionReturn);
+
+	for (SourceLocation const& location: _findings.unreachableLocations)
+		if (m_unreachableLocationsAlreadyWarnedFor.emplace(location).second)
+			m_errorReporter.warning(5740_error, location, "Unreachable code.");
 }
 
 
-void ControlFlowAnalyzer::checkUninitializedAccess(CFGNode const* _entry, CFGNode const* _exit, bool _emptyBody, std::optional<std::string> _contractName)
+std::vector<VariableOccurrence const*> ControlFlowAnalyzer::uninitializedAccesses(CFGNode const* _entry, CFGNode const* _exit)
 {
 	struct NodeInfo
 	{
@@ -135,65 +158,75 @@ void ControlFlowAnalyzer::checkUninitializedAccess(CFGNode const* _entry, CFGNod
 	}
 
 	auto const& exitInfo = nodeInfos[_exit];
-	if (!exitInfo.uninitializedVariableAccesses.empty())
+	std::vector<VariableOccurrence const*> uninitializedAccessesOrdered(
+		exitInfo.uninitializedVariableAccesses.begin(),
+		exitInfo.uninitializedVariableAccesses.end()
+	);
+	ranges::sort(
+		uninitializedAccessesOrdered,
+		[](VariableOccurrence const* lhs, VariableOccurrence const* rhs) -> bool
+		{
+			return *lhs < *rhs;
+		}
+	);
+	return uninitializedAccessesOrdered;
+}
+
+void ControlFlowAnalyzer::reportUninitializedAccesses(
+	std::vector<VariableOccurrence const*> const& _accesses,
+	bool _emptyBody,
+	std::optional<std::string> _contractName
+)
+{
+	for (auto const* variableOccurrence: _accesses)
 	{
-		std::vector<VariableOccurrence const*> uninitializedAccessesOrdered(
-			exitInfo.uninitializedVariableAccesses.begin(),
-			exitInfo.uninitializedVariableAccesses.end()
-		);
-		ranges::sort(
-			uninitializedAccessesOrdered,
-			[](VariableOccurrence const* lhs, VariableOccurrence const* rhs) -> bool
-			{
-				return *lhs < *rhs;
-			}
-		);
+		VariableDeclaration const& varDecl = variableOccurrence->declaration();
 
-		for (auto const* variableOccurrence: uninitializedAccessesOrdered)
-		{
-			VariableDeclaration const& varDecl = variableOccurrence->declaration();
-
-			SecondarySourceLocation ssl;
-			if (variableOccurrence->occurrence())
-				ssl.append("The variable was declared here.", varDecl.location());
-
-			bool isStorage = varDecl.type()->dataStoredIn(DataLocation::Storage);
-			bool isCalldata = varDecl.type()->dataStoredIn(DataLocation::CallData);
-			if (isStorage || isCalldata)
-				m_errorReporter.typeError(
-					3464_error,
-					variableOccurrence->occurrence() ?
-						*variableOccurrence->occurrence() :
-						varDecl.location(),
-					ssl,
-					"This variable is of " +
-					std::string(isStorage ? "storage" : "calldata") +
-					" pointer type and can be " +
-					(variableOccurrence->kind() == VariableOccurrence::Kind::Return ? "returned" : "accessed") +
-					" without prior assignment, which would lead to undefined behaviour."
-				);
-			else if (!_emptyBody && varDecl.name().empty())
-			{
-				if (!m_unassignedReturnVarsAlreadyWarnedFor.emplace(&varDecl).second)
-					continue;
+		SecondarySourceLocation ssl;
+		if (variableOccurrence->occurrence())
+			ssl.append("The variable was declared here.", varDecl.location());
 
-				m_errorReporter.warning(
-					6321_error,
+		bool isStorage = varDecl.type()->dataStoredIn(DataLocation::Storage);
+		bool isCalldata = varDecl.type()->dataStoredIn(DataLocation::CallData);
+		if (isStorage || isCalldata)
+			m_errorReporter.typeError(
+				3464_error,
+				variableOccurrence->occurrence() ?
+					*variableOccurrence->occurrence() :
 					varDecl.location(),
-					"Unnamed return variable can remain unassigned" +
-					(
-						_contractName.has_value() ?
-						" when the function is called when \"" + _contractName.value() + "\" is the most derived contract." :
-						"."
-					) +
-					" Add an explicit return with value to all non-reverting code paths or name the variable."
-				);
-			}
+				ssl,
+				"This variable is of " +
+				std::string(isStorage ? "storage" : "calldata") +
+				" pointer type and can be " +
+				(variableOccurrence->kind() == VariableOccurrence::Kind::Return ? "returned" : "accessed") +
+				" without prior assignment, which would lead to undefined behaviour."
+			);
+		else if (!_emptyBody && varDecl.name().empty())
+		{
+			if (!m_unassignedReturnVarsAlreadyWarnedFor.emplace(&varDecl).second)
+				continue;
+
+			m_errorReporter.warning(
+				6321_error,
+				varDecl.location(),
+				"Unnamed return variable can remain unassigned" +
+				(
+					_contractName.has_value() ?
+					" when the function is called when \"" + _contractName.value() + "\" is the most derived contract." :
+					"."
+				) +
+				" Add an explicit return with value to all non-reverting code paths or name the variable."
+			);
 		}
 	}
 }
 
-void ControlFlowAnalyzer::checkUnreachable(CFGNode const* _entry, CFGNode const* _exit, CFGNode const* _revert, CFGNode const* _transactionReturn)
+std::vector<SourceLocation> ControlFlowAnalyzer::unreachableLocations(
+	CFGNode const* _entry,
+	CFGNode const* _exit,
+	CFGNode const* _revert,
+	CFGNode const* _transactionReturn
+)
 {
 	// collect all nodes reachable from the entry point
 	std::set<CFGNode const*> reachable = util::BreadthFirstSearch<CFGNode const*>{{_entry}}.run(
@@ -215,14 +248,14 @@ void ControlFlowAnalyzer::checkUnreachable(CFGNode const* _entry, CFGNode const*
 		}
 	);
 
+	std::vector<SourceLocation> locations;
 	for (auto it = unreachable.begin(); it != unreachable.end();)
 	{
 		SourceLocation location = *it++;
 		// Extend the location, as long as the next location overlaps (unreachable is sorted).
 		for (; it != unreachable.end() && it->start <= location.end; ++it)
 			location.end = std::max(location.end, it->end);
-
-		if (m_unreachableLocationsAlreadyWarnedFor.emplace(location).second)
-			m_errorReporter.warning(5740_error, location, "Unreachable code.");
+		locations.push_back(std::move(location));
 	}
+	return locations;
 }
@@ -20,7 +20,10 @@
 
 #include <libsolidity/analysis/ControlFlowGraph.h>
 #include <liblangutil/ErrorReporter.h>
+#include <optional>
 #include <set>
+#include <string>
+#include <vector>
 
 namespace solidity::frontend
 {
@@ -28,26 +31,52 @@ namespace solidity::frontend
 class ControlFlowAnalyzer
 {
 public:
-	explicit ControlFlowAnalyzer(CFG const& _cfg, langutil::ErrorReporter& _errorReporter):
-		m_cfg(_cfg), m_errorReporter(_errorReporter) {}
+	/// @param _workers maximum number of threads used to analyze the functions.
+	explicit ControlFlowAnalyzer(CFG const& _cfg, langutil::ErrorReporter& _errorReporter, size_t _workers = 1):
+		m_cfg(_cfg), m_errorReporter(_errorReporter), m_workers(_workers) {}
 
+	/// Analyzes the control flow of all functions. The flows are only read, so the functions
+	/// can be analyzed concurrently. The findings are reported afterwards, in the order of the functions.
 	bool run();
 
 private:
-	void analyze(FunctionDefinition const& _function, ContractDefinition const* _contract, FunctionFlow const& _flow);
-	/// Checks for uninitialized variable accesses in the control flow between @param _entry and @param _exit.
+	/// Findings of the analysis of the control flow of a single function.
+	struct FunctionFindings
+	{
+		std::vector<VariableOccurrence const*> uninitializedAccesses;
+		std::vector<langutil::SourceLocation> unreachableLocations;
+	};
+
+	static FunctionFindings analyze(FunctionFlow const& _flow);
+	/// @returns the accesses to variables that can happen without prior assignment in the control flow
+	/// between @param _entry and @param _exit, in source order.
 	/// @param _entry entry node
 	/// @param _exit exit node
+	static std::vector<VariableOccurrence const*> uninitializedAccesses(CFGNode const* _entry, CFGNode const* _exit);
+	/// @returns the (merged) locations of unreachable code, i.e. code ending in @param _exit,
+	/// @param _revert or @param _transactionReturn that can not be reached from @param _entry.
+	static std::vector<langutil::SourceLocation> unreachableLocations(
+		CFGNode const* _entry,
+		CFGNode const* _exit,
+		CFGNode const* _revert,
+		CFGNode const* _transactionReturn
+	);
+
+	/// Reports the findings for @a _function, analyzed as part of @a _contract.
+	void report(FunctionDefinition const& _function, ContractDefinition const* _contract, FunctionFindings const& _findings);
+	/// Reports uninitialized variable accesses.
 	/// @param _emptyBody whether the body of the function is empty (true) or not (false)
 	/// @param _contractName name of the most derived contract, should be empty
 	///        if the function is also defined in it
-	void checkUninitializedAccess(CFGNode const* _entry, CFGNode const* _exit, bool _emptyBody, std::optional<std::string> _contractName = {});
-	/// Checks for unreachable code, i.e. code ending in @param _exit, @param _revert or @param _transactionReturn
-	/// that can not be reached from @param _entry.
-	void checkUnreachable(CFGNode const* _entry, CFGNode const* _exit, CFGNode const* _revert, CFGNode const* _transactionReturn);
+	void reportUninitializedAccesses(
+		std::vector<VariableOccurrence const*> const& _accesses,
+		bool _emptyBody,
+		std::optional<std::string> _contractName = {}
+	);
 
 	CFG const& m_cfg;
 	langutil::ErrorReporter& m_errorReporter;
+	size_t m_workers;
 
 	std::set<langutil::SourceLocation> m_unreachableLocationsAlreadyWarnedFor;
 	std::set<VariableDeclaration const*> m_unassignedReturnVarsAlreadyWarnedFor;
@@ -32,6 +32,68 @@
 using namespace solidity;
 using namespace solidity::frontend;
 
+namespace
+{
+
+// Because the edit distance computation has quadratic runtime, it is not used for long names.
+// Since 80 is the suggested line length limit, we use 80^2 as length threshold.
+size_t constexpr c_maximumLengthThreshold = 80 * 80;
+size_t constexpr c_maximumEditDistance = 2;
+
+size_t maximumEditDistance(ASTString const& _name)
+{
+	return _name.size() > 3 ? c_maximumEditDistance : _name.size() / 2;
+}
+
+/// Adds the hashes of all strings that can be obtained from @a _name by removing
+/// at most @a _deletions characters, starting at position @a _start or later, to @a _hashes.
+void addDeletionVariants(std::string& _name, size_t _start, size_t _deletions, std::vector<size_t>& _hashes)
+{
+	_hashes.push_back(std::hash<std::string>{}(_name));
+	if (_deletions == 0)
+		return;
+	for (size_t i = _start; i < _name.size(); ++i)
+	{
+		char const removed = _name[i];
+		_name.erase(i, 1);
+		addDeletionVariants(_name, i, _deletions - 1, _hashes);
+		_name.insert(i, 1, removed);
+	}
+}
+
+std::vector<size_t> deletionVariants(ASTString const& _name, size_t _deletions)
+{
+	std::vector<size_t> hashes;
+	std::string name = _name;
+	addDeletionVariants(name, 0, _deletions, hashes);
+	std::sort(hashes.begin(), hashes.end());
+	hashes.erase(std::unique(hashes.begin(), hashes.end()), hashes.end());
+	return hashes;
+}
+
+}
+
+/// Index of the names declared in a container for finding the ones similar to a given name.
+/// Two names within edit distance k of each other (where a transposition counts as a single edit)
+/// can both be turned into the same string by removing at most k characters from each.
+/// The index maps the strings obtainable this way to the names, so that the edit distance only
+/// has to be computed for names sharing one with the query.
+struct DeclarationContainer::SimilarNamesIndex
+{
+	/// Containers with fewer names are searched directly.
+	static size_t constexpr minimumNameCount = 64;
+	/// Longer names have too many variants to be indexed and are compared directly.
+	static size_t constexpr maximumIndexedLength = 32;
+
+	/// All names in the order in which similarNames() reports them: visible ones first,
+	/// both groups in alphabetical order.
+	std::vector<ASTString const*> names;
+	/// Pairs of a variant hash and an index into @a names, sorted.
+	std::vector<std::pair<size_t, size_t>> variants;
+	/// Indices of names which are too long to be indexed.
+	std::vector<size_t> unindexedNames;
+};
+
 Declaration const* DeclarationContainer::conflictingDeclaration(
 	Declaration const& _declaration,
 	ASTString const* _name
@@ -91,6 +153,7 @@ void DeclarationContainer::activateVariable(ASTString const& _name)
 	solAssert(m_declarations.count(_name) == 0 || m_declarations.at(_name).empty(), "");
 	m_declarations[_name].emplace_back(m_invisibleDeclarations.at(_name).front());
 	m_invisibleDeclarations.erase(_name);
+	m_similarNamesIndex.reset();
 }
 
 bool DeclarationContainer::isInvisible(ASTString const& _name) const
@@ -126,6 +189,7 @@ bool DeclarationContainer::registerDeclaration(
 			m_homonymCandidates.emplace_back(*_name, _location ? _location : &_declaration.location());
 	}
 
+	m_similarNamesIndex.reset();
 	std::vector<Declaration const*>& decls = _invisible ? m_invisibleDeclarations[*_name] : m_declarations[*_name];
 	if (!util::contains(decls, &_declaration))
 		decls.push_back(&_declaration);
@@ -173,24 +237,35 @@ std::vector<Declaration const*> DeclarationContainer::resolveName(
 
 std::vector<ASTString> DeclarationContainer::similarNames(ASTString const& _name) const
 {
-
-	// because the function below has quadratic runtime - it will not magically improve once a better algorithm is discovered ;)
-	// since 80 is the suggested line length limit, we use 80^2 as length threshold
-	static size_t const MAXIMUM_LENGTH_THRESHOLD = 80 * 80;
-
 	std::vector<ASTString> similar;
-	size_t maximumEditDistance = _name.size() > 3 ? 2 : _name.size() / 2;
-	for (auto const& declaration: m_declarations)
+	size_t const maximumDistance = maximumEditDistance(_name);
+	auto addIfSimilar = [&](ASTString const& _declarationName) {
+		if (util::stringWithinDistance(_name, _declarationName, maximumDistance, c_maximumLengthThreshold))
+			similar.push_back(_declarationName);
+	};
+
+	if (SimilarNamesIndex const* index = similarNamesIndex())
 	{
-		std::string const& declarationName = declaration.first;
-		if (util::stringWithinDistance(_name, declarationName, maximumEditDistance, MAXIMUM_LENGTH_THRESHOLD))
-			similar.push_back(declarationName);
+		std::vector<size_t> candidates = index->unindexedNames;
+		if (_name.size() <= SimilarNamesIndex::maximumIndexedLength + c_maximumEditDistance)
+			for (size_t variant: deletionVariants(_name, maximumDistance))
+				for (
+					auto it = std::lower_bound(index->variants.begin(), index->variants.end(), std::make_pair(variant, size_t(0)));
+					it != index->variants.end() && it->first == variant;
+					++it
+				)
+					candidates.push_back(it->second);
+		std::sort(candidates.begin(), candidates.end());
+		candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+		for (size_t candidate: candidates)
+			addIfSimilar(*index->names[candidate]);
 	}
-	for (auto const& declaration: m_invisibleDeclarations)
+	else
 	{
-		std::string const& declarationName = declaration.first;
-		if (util::stringWithinDistance(_name, declarationName, maximumEditDistance, MAXIMUM_LENGTH_THRESHOLD))
-			similar.push_back(declarationName);
+		for (auto const& declaration: m_declarations)
+			addIfSimilar(declaration.first);
+		for (auto const& declaration: m_invisibleDeclarations)
+			addIfSimilar(declaration.first);
 	}
 
 	if (m_enclosingContainer)
@@ -199,6 +274,31 @@ std::vector<ASTString> DeclarationContainer::similarNames(ASTString const& _name
 	return similar;
 }
 
+DeclarationContainer::SimilarNamesIndex const* DeclarationContainer::similarNamesIndex() const
+{
+	if (m_declarations.size() + m_invisibleDeclarations.size() < SimilarNamesIndex::minimumNameCount)
+		return nullptr;
+
+	if (!m_similarNamesIndex)
+	{
+		auto index = std::make_shared<SimilarNamesIndex>();
+		for (auto const* declarations: {&m_declarations, &m_invisibleDeclarations})
+			for (auto const& declaration: *declarations)
+			{
+				size_t const nameIndex = index->names.size();
+				index->names.push_back(&declaration.first);
+				if (declaration.first.size() > SimilarNamesIndex::maximumIndexedLength)
+					index->unindexedNames.push_back(nameIndex);
+				else
+					for (size_t variant: deletionVariants(declaration.first, c_maximumEditDistance))
+						index->variants.emplace_back(variant, nameIndex);
+			}
+		std::sort(index->variants.begin(), index->variants.end());
+		m_similarNamesIndex = std::move(index);
+	}
+	return m_similarNamesIndex.get();
+}
+
 void DeclarationContainer::populateHomonyms(std::back_insert_iterator<Homonyms> _it) const
 {
 	for (DeclarationContainer const* innerContainer: m_innerContainers)
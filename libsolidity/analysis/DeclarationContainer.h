@@ -100,6 +100,12 @@ public:
 	void populateHomonyms(std::back_insert_iterator<Homonyms> _it) const;
 
 private:
+	struct SimilarNamesIndex;
+
+	/// @returns the index of the names in this container, building it if necessary,
+	/// or nullptr if there are too few names to make it worthwhile.
+	SimilarNamesIndex const* similarNamesIndex() const;
+
 	ASTNode const* m_enclosingNode = nullptr;
 	DeclarationContainer const* m_enclosingContainer = nullptr;
 	std::vector<DeclarationContainer const*> m_innerContainers;
@@ -107,6 +113,8 @@ private:
 	std::map<ASTString, std::vector<Declaration const*>> m_invisibleDeclarations;
 	/// List of declarations (name and location) to check later for homonymity.
 	std::vector<std::pair<std::string, langutil::SourceLocation const*>> m_homonymCandidates;
+	/// Built on first use by similarNames() and discarded whenever a name is registered or activated.
+	mutable std::shared_ptr<SimilarNamesIndex const> m_similarNamesIndex;
 };
 
 }
@@ -439,7 +439,16 @@ void NameAndTypeResolver::linearizeBaseContracts(ContractDefinition& _contract)
 		input.push_front(std::list<ContractDefinition const*>(basesBases.begin(), basesBases.end()));
 	}
 	input.back().push_front(&_contract);
-	std::vector<ContractDefinition const*> result = cThreeMerge(input);
+	std::vector<ContractDefinition const*> result;
+	if (_contract.baseContracts().size() == 1 && !util::contains(input.front(), &_contract))
+	{
+		// With a single base, the merge yields the contract followed by the linearization of the base.
+		// This is by far the most common case, so avoid the quadratic merge.
+		result.push_back(&_contract);
+		result += input.front();
+	}
+	else
+		result = cThreeMerge(input);
 	if (result.empty())
 		m_errorReporter.fatalTypeError(5005_error, _contract.location(), "Linearization of inheritance graph impossible");
 	_contract.annotation().linearizedBaseContracts = result;
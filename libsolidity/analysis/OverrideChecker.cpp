@@ -924,53 +924,69 @@ void OverrideChecker::checkOverrideList(OverrideProxy _item, OverrideProxyBySign
 
 OverrideChecker::OverrideProxyBySignatureMultiSet const& OverrideChecker::inheritedFunctions(ContractDefinition const& _contract) const
 {
-	if (!m_inheritedFunctions.count(&_contract))
+	if (auto it = m_inheritedFunctions.find(&_contract); it != m_inheritedFunctions.end())
+		return it->second;
+
+	OverrideProxyBySignatureMultiSet result;
+
+	for (auto const* base: resolveDirectBaseContracts(_contract))
 	{
-		OverrideProxyBySignatureMultiSet result;
+		OverrideProxyBySignatureSet const& functionsInBase = definedFunctions(*base);
 
-		for (auto const* base: resolveDirectBaseContracts(_contract))
-		{
-			std::set<OverrideProxy, OverrideProxy::CompareBySignature> functionsInBase;
-			for (FunctionDefinition const* fun: base->definedFunctions())
-				if (!fun->isConstructor())
-					functionsInBase.emplace(OverrideProxy{fun});
-			for (VariableDeclaration const* var: base->stateVariables())
-				if (var->isPublic())
-					functionsInBase.emplace(OverrideProxy{var});
-
-			result += functionsInBase;
-
-			for (OverrideProxy const& func: inheritedFunctions(*base))
-				if (!functionsInBase.count(func))
-					result.insert(func);
-		}
+		result += functionsInBase;
 
-		m_inheritedFunctions[&_contract] = result;
+		for (OverrideProxy const& func: inheritedFunctions(*base))
+			if (!functionsInBase.count(func))
+				result.insert(func);
 	}
 
-	return m_inheritedFunctions[&_contract];
+	return m_inheritedFunctions.emplace(&_contract, std::move(result)).first->second;
 }
 
 OverrideChecker::OverrideProxyBySignatureMultiSet const& OverrideChecker::inheritedModifiers(ContractDefinition const& _contract) const
 {
-	if (!m_inheritedModifiers.count(&_contract))
-	{
-		OverrideProxyBySignatureMultiSet result;
+	if (auto it = m_inheritedModifiers.find(&_contract); it != m_inheritedModifiers.end())
+		return it->second;
 
-		for (auto const* base: resolveDirectBaseContracts(_contract))
-		{
-			std::set<OverrideProxy, OverrideProxy::CompareBySignature> modifiersInBase;
-			for (ModifierDefinition const* mod: base->functionModifiers())
-				modifiersInBase.emplace(OverrideProxy{mod});
+	OverrideProxyBySignatureMultiSet result;
 
-			for (OverrideProxy const& mod: inheritedModifiers(*base))
-				modifiersInBase.insert(mod);
+	for (auto const* base: resolveDirectBaseContracts(_contract))
+	{
+		OverrideProxyBySignatureSet modifiersInBase = definedModifiers(*base);
 
-			result += modifiersInBase;
-		}
+		for (OverrideProxy const& mod: inheritedModifiers(*base))
+			modifiersInBase.insert(mod);
 
-		m_inheritedModifiers[&_contract] = result;
+		result += modifiersInBase;
 	}
 
-	return m_inheritedModifiers[&_contract];
+	return m_inheritedModifiers.emplace(&_contract, std::move(result)).first->second;
+}
+
+OverrideChecker::OverrideProxyBySignatureSet const& OverrideChecker::definedFunctions(ContractDefinition const& _contract) const
+{
+	if (auto it = m_definedFunctions.find(&_contract); it != m_definedFunctions.end())
+		return it->second;
+
+	OverrideProxyBySignatureSet result;
+	for (FunctionDefinition const* fun: _contract.definedFunctions())
+		if (!fun->isConstructor())
+			result.emplace(OverrideProxy{fun});
+	for (VariableDeclaration const* var: _contract.stateVariables())
+		if (var->isPublic())
+			result.emplace(OverrideProxy{var});
+
+	return m_definedFunctions.emplace(&_contract, std::move(result)).first->second;
+}
+
+OverrideChecker::OverrideProxyBySignatureSet const& OverrideChecker::definedModifiers(ContractDefinition const& _contract) const
+{
+	if (auto it = m_definedModifiers.find(&_contract); it != m_definedModifiers.end())
+		return it->second;
+
+	OverrideProxyBySignatureSet result;
+	for (ModifierDefinition const* mod: _contract.functionModifiers())
+		result.emplace(OverrideProxy{mod});
+
+	return m_definedModifiers.emplace(&_contract, std::move(result)).first->second;
 }
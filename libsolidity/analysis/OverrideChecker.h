@@ -137,6 +137,7 @@ private:
 class OverrideChecker
 {
 public:
+	using OverrideProxyBySignatureSet = std::set<OverrideProxy, OverrideProxy::CompareBySignature>;
 	using OverrideProxyBySignatureMultiSet = std::multiset<OverrideProxy, OverrideProxy::CompareBySignature>;
 
 	/// @param _errorReporter provides the error logging functionality.
@@ -157,6 +158,14 @@ public:
 	OverrideProxyBySignatureMultiSet const& inheritedModifiers(ContractDefinition const& _contract) const;
 
 private:
+	/// @returns the functions (except for the constructor) and public state variables
+	/// defined in the contract itself.
+	/// The same proxies are returned for every contract deriving from it, so that their
+	/// comparators are computed only once.
+	OverrideProxyBySignatureSet const& definedFunctions(ContractDefinition const& _contract) const;
+	/// @returns the modifiers defined in the contract itself.
+	OverrideProxyBySignatureSet const& definedModifiers(ContractDefinition const& _contract) const;
+
 	void checkIllegalOverrides(ContractDefinition const& _contract);
 	/// Performs various checks related to @a _overriding overriding @a _super like
 	/// different return type, invalid visibility change, etc.
@@ -191,6 +200,9 @@ private:
 	/// Cache for inheritedFunctions().
 	std::map<ContractDefinition const*, OverrideProxyBySignatureMultiSet> mutable m_inheritedFunctions;
 	std::map<ContractDefinition const*, OverrideProxyBySignatureMultiSet> mutable m_inheritedModifiers;
+	/// Caches for definedFunctions() and definedModifiers().
+	std::map<ContractDefinition const*, OverrideProxyBySignatureSet> mutable m_definedFunctions;
+	std::map<ContractDefinition const*, OverrideProxyBySignatureSet> mutable m_definedModifiers;
 };
 
 }
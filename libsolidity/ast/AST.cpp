@@ -371,6 +371,15 @@ std::multimap<std::string, FunctionDefinition const*> const& ContractDefinition:
 	});
 }
 
+void ContractDefinition::resetCaches()
+{
+	// Interface functions and events depend on the types and the inheritance hierarchy
+	// determined during analysis. Functions defined by name depend only on the AST itself.
+	for (auto& interfaceFunctionList: m_interfaceFunctionList)
+		interfaceFunctionList.reset();
+	m_interfaceEvents.reset();
+}
+
 StorageLayoutSpecifier::StorageLayoutSpecifier(
 	int64_t _id,
 	SourceLocation const& _location,
@@ -79,6 +79,9 @@ public:
 
 	/// @returns an identifier of this AST node that is unique for a single compilation run.
 	int64_t id() const { return int64_t(m_id); }
+	/// Adds @a _offset to the identifier. Used to move source units that were parsed
+	/// independently of each other into a common range of identifiers before analysis.
+	void shiftID(int64_t _offset) { m_id = static_cast<size_t>(int64_t(m_id) + _offset); }
 
 	virtual void accept(ASTVisitor& _visitor) = 0;
 	virtual void accept(ASTConstVisitor& _visitor) const = 0;
@@ -116,6 +119,8 @@ public:
 
 	///@todo make this const-safe by providing a different way to access the annotation
 	virtual ASTAnnotation& annotation() const;
+	/// Discards the annotation, e.g. before the AST is analyzed again.
+	void resetAnnotation() { m_annotation.reset(); }
 
 	///@{
 	///@name equality operators
@@ -127,7 +132,7 @@ public:
 	virtual bool experimentalSolidityOnly() const { return false; }
 
 protected:
-	size_t const m_id = 0;
+	size_t m_id = 0;
 
 	template <class T>
 	T& initAnnotation() const
@@ -595,6 +600,9 @@ public:
 	/// @returns the next constructor in the inheritance hierarchy.
 	FunctionDefinition const* nextConstructor(ContractDefinition const& _mostDerivedContract) const;
 
+	/// Discards the values computed lazily from the analyzed contract, e.g. before the AST is analyzed again.
+	void resetCaches();
+
 private:
 	std::multimap<std::string, FunctionDefinition const*> const& definedFunctionsByName() const;
 
@@ -2433,6 +2441,7 @@ public:
 	void accept(ASTConstVisitor& _visitor) const override;
 
 	ElementaryTypeName const& type() const { return *m_type; }
+	ElementaryTypeName& type() { return *m_type; }
 
 private:
 	ASTPointer<ElementaryTypeName> m_type;
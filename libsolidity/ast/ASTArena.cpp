@@ -0,0 +1,51 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolidity/ast/ASTArena.h>
+
+#include <liblangutil/Exceptions.h>
+
+#include <algorithm>
+
+using namespace solidity::frontend;
+
+void* ASTArena::allocate(size_t _size, size_t _alignment)
+{
+	solAssert(_alignment > 0 && (_alignment & (_alignment - 1)) == 0);
+	solAssert(_alignment <= alignof(std::max_align_t));
+
+	void* result = m_current;
+	if (!std::align(_alignment, _size, result, m_remaining))
+	{
+		// Objects that do not fit into a regular block get a block of their own
+		// and the current block is kept for the following allocations.
+		size_t const blockSize = std::max(c_blockSize, _size);
+		m_blocks.emplace_back(new std::byte[blockSize]);
+		m_reservedSize += blockSize;
+		if (blockSize > c_blockSize)
+			return m_blocks.back().get();
+
+		m_current = m_blocks.back().get();
+		m_remaining = blockSize;
+		result = m_current;
+	}
+
+	m_current = static_cast<std::byte*>(result) + _size;
+	m_remaining -= _size;
+	return result;
+}
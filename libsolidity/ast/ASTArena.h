@@ -0,0 +1,89 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Memory arena for the nodes of a single source unit.
+ */
+
+#pragma once
+
+#include <libsolidity/ast/ASTForward.h>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace solidity::frontend
+{
+
+/// Monotonic memory arena. Memory handed out by it is never reused and is only released,
+/// all at once, when the arena is destroyed.
+/// Not thread-safe, i.e. a single arena must not be allocated from concurrently.
+class ASTArena
+{
+public:
+	ASTArena() = default;
+	ASTArena(ASTArena const&) = delete;
+	ASTArena& operator=(ASTArena const&) = delete;
+
+	void* allocate(size_t _size, size_t _alignment);
+
+	/// @returns the number of bytes reserved from the system so far.
+	size_t reservedSize() const { return m_reservedSize; }
+
+private:
+	static size_t constexpr c_blockSize = 64 * 1024;
+
+	std::vector<std::unique_ptr<std::byte[]>> m_blocks;
+	std::byte* m_current = nullptr;
+	size_t m_remaining = 0;
+	size_t m_reservedSize = 0;
+};
+
+/// Allocator placing objects in an @a ASTArena. Each copy keeps the arena alive, so that when used
+/// with std::allocate_shared(), the arena lives until the last object allocated from it is destroyed.
+/// Deallocation is a no-op.
+template <typename T>
+class ASTArenaAllocator
+{
+public:
+	using value_type = T;
+
+	explicit ASTArenaAllocator(std::shared_ptr<ASTArena> _arena): m_arena(std::move(_arena)) {}
+	template <typename U>
+	ASTArenaAllocator(ASTArenaAllocator<U> const& _other): m_arena(_other.m_arena) {}
+
+	T* allocate(size_t _count) { return static_cast<T*>(m_arena->allocate(_count * sizeof(T), alignof(T))); }
+	void deallocate(T*, size_t) noexcept {}
+
+	template <typename U>
+	bool operator==(ASTArenaAllocator<U> const& _other) const { return m_arena == _other.m_arena; }
+
+private:
+	template <typename U> friend class ASTArenaAllocator;
+
+	std::shared_ptr<ASTArena> m_arena;
+};
+
+/// Creates an object in @a _arena. Behaves like std::make_shared() otherwise.
+template <typename T, typename... Args>
+ASTPointer<T> makeInArena(std::shared_ptr<ASTArena> const& _arena, Args&&... _args)
+{
+	return std::allocate_shared<T>(ASTArenaAllocator<T>(_arena), std::forward<Args>(_args)...);
+}
+
+}
@@ -131,9 +131,8 @@ struct ASTCompareByID
 	}
 };
 
-// Used as pointers to AST nodes, to be replaced by more clever pointers, e.g. pointers which do
-// not do reference counting but point to a special memory area that is completely released
-// explicitly.
+// Used as pointers to AST nodes. The parser allocates the nodes of each source unit in
+// a common memory area (see ASTArena), which is released at once with the last node.
 template <class T>
 using ASTPointer = std::shared_ptr<T>;
 
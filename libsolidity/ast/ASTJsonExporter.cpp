@@ -237,7 +237,7 @@ bool ASTJsonExporter::visit(SourceUnit const& _node)
 				exportedSymbols[sym.first].emplace_back(nodeId(*overload));
 		}
 
-		attributes.emplace_back("exportedSymbols", exportedSymbols);
+		attributes.emplace_back("exportedSymbols", std::move(exportedSymbols));
 	};
 
 	addIfSet(attributes, "absolutePath", _node.annotation().path);
@@ -279,7 +279,7 @@ bool ASTJsonExporter::visit(ImportDirective const& _node)
 		tuple["foreign"] = toJson(*symbolAlias.symbol);
 		tuple["local"] =  symbolAlias.alias ? Json(*symbolAlias.alias) : Json();
 		tuple["nameLocation"] = sourceLocationToString(_node.nameLocation());
-		symbolAliases.emplace_back(tuple);
+		symbolAliases.emplace_back(std::move(tuple));
 	}
 	attributes.emplace_back("symbolAliases", std::move(symbolAliases));
 	setJsonNode(_node, "ImportDirective", std::move(attributes));
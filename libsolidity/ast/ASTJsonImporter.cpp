@@ -38,6 +38,8 @@
 #include <boost/algorithm/string.hpp>
 
 #include <range/v3/algorithm/find_if.hpp>
+#include <range/v3/range/conversion.hpp>
+#include <range/v3/view/map.hpp>
 
 namespace solidity::frontend
 {
@@ -58,17 +60,27 @@ ASTPointer<T> ASTJsonImporter::nullOrCast(Json const& _json)
 
 std::map<std::string, ASTPointer<SourceUnit>> ASTJsonImporter::jsonToSourceUnit(std::map<std::string, Json> const& _sourceList)
 {
-	for (auto const& src: _sourceList)
-		m_sourceNames.emplace_back(std::make_shared<std::string const>(src.first));
+	declareSources(_sourceList | ranges::views::keys | ranges::to<std::vector<std::string>>);
 	for (auto const& srcPair: _sourceList)
-	{
-		astAssert(!srcPair.second.is_null());
-		astAssert(member(srcPair.second,"nodeType") == "SourceUnit", "The 'nodeType' of the highest node must be 'SourceUnit'.");
-		m_sourceUnits[srcPair.first] = createSourceUnit(srcPair.second, srcPair.first);
-	}
+		jsonToSourceUnit(srcPair.second, srcPair.first);
 	return m_sourceUnits;
 }
 
+void ASTJsonImporter::declareSources(std::vector<std::string> const& _sourceNames)
+{
+	astAssert(m_sourceNames.empty(), "Sources can only be declared once.");
+	for (auto const& name: _sourceNames)
+		m_sourceNames.emplace_back(std::make_shared<std::string const>(name));
+}
+
+ASTPointer<SourceUnit> ASTJsonImporter::jsonToSourceUnit(Json const& _source, std::string const& _sourceName)
+{
+	astAssert(!_source.is_null());
+	astAssert(member(_source, "nodeType") == "SourceUnit", "The 'nodeType' of the highest node must be 'SourceUnit'.");
+	astAssert(!m_sourceNames.empty(), "Sources have to be declared before they are imported.");
+	return m_sourceUnits[_sourceName] = createSourceUnit(_source, _sourceName);
+}
+
 // ============ private ===========================
 
 // =========== general creation functions ==============
@@ -49,6 +49,14 @@ public:
 	/// @returns map of sourcenames to their respective ASTs
 	std::map<std::string, ASTPointer<SourceUnit>> jsonToSourceUnit(std::map<std::string, Json> const& _sourceList);
 
+	/// Registers the names of all sources that are going to be imported.
+	/// Source locations refer to sources by their index in @a _sourceNames, so this has to be
+	/// called once, before any of the sources is converted via jsonToSourceUnit(Json const&, std::string const&).
+	void declareSources(std::vector<std::string> const& _sourceNames);
+	/// Converts the AST of the single source @a _sourceName from JSON-format to ASTPointer.
+	/// Allows the caller to release the JSON of each source as soon as it has been converted.
+	ASTPointer<SourceUnit> jsonToSourceUnit(Json const& _source, std::string const& _sourceName);
+
 private:
 
 	// =========== general creation functions ==============
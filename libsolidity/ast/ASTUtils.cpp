@@ -47,6 +47,46 @@ ASTNode const* locateInnermostASTNode(int _offsetInFile, SourceUnit const& _sour
 	return innermostMatch;
 }
 
+void shiftNodeIDs(SourceUnit& _sourceUnit, int64_t _offset)
+{
+	class NodeIDShifter: public ASTVisitor
+	{
+	public:
+		explicit NodeIDShifter(int64_t _offset): m_offset(_offset) {}
+
+	private:
+		// Some nodes are not visited by accept() and have to be handled explicitly.
+		bool visit(StructDefinition& _struct) override { return visitDocumented(_struct, _struct); }
+		bool visit(EnumDefinition& _enum) override { return visitDocumented(_enum, _enum); }
+		bool visit(VariableDeclaration& _variable) override { return visitDocumented(_variable, _variable); }
+		bool visit(ElementaryTypeNameExpression& _expression) override
+		{
+			_expression.type().shiftID(m_offset);
+			return visitNode(_expression);
+		}
+
+		bool visitDocumented(ASTNode& _node, StructurallyDocumented const& _documented)
+		{
+			if (_documented.documentation())
+				_documented.documentation()->shiftID(m_offset);
+			return visitNode(_node);
+		}
+
+		bool visitNode(ASTNode& _node) override
+		{
+			_node.shiftID(m_offset);
+			return true;
+		}
+
+		int64_t m_offset;
+	};
+
+	if (_offset == 0)
+		return;
+	NodeIDShifter shifter(_offset);
+	_sourceUnit.accept(shifter);
+}
+
 bool isConstantVariableRecursive(VariableDeclaration const& _varDecl)
 {
 	solAssert(_varDecl.isConstant(), "Constant variable expected");
@@ -41,6 +41,9 @@ bool isConstantVariableRecursive(VariableDeclaration const& _varDecl);
 /// Returns the innermost AST node that covers the given location or nullptr if not found.
 ASTNode const* locateInnermostASTNode(int _offsetInFile, SourceUnit const& _sourceUnit);
 
+/// Adds @a _offset to the IDs of all nodes of @a _sourceUnit.
+void shiftNodeIDs(SourceUnit& _sourceUnit, int64_t _offset);
+
 /// @returns @a _expr itself, in case it is not a unary tuple expression. Otherwise it descends recursively
 /// into unary tuples and returns the contained expression.
 Expression const* resolveOuterUnaryTuples(Expression const* _expr);
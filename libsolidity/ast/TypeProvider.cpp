@@ -191,17 +191,29 @@ void TypeProvider::reset()
 	clearCaches(instance().m_bytesM);
 	clearCaches(instance().m_magics);
 
-	instance().m_generalTypes.clear();
-	instance().m_stringLiteralTypes.clear();
-	instance().m_ufixedMxN.clear();
-	instance().m_fixedMxN.clear();
+	instance() = TypeProvider{};
 }
 
-template <typename T, typename... Args>
-inline T const* TypeProvider::createAndGet(Args&& ... _args)
+template <typename T, typename Key, typename... Args>
+inline T const* TypeProvider::createAndGet(std::map<Key, std::unique_ptr<T>>& _types, std::type_identity_t<Key> _key, Args&& ... _args)
 {
-	instance().m_generalTypes.emplace_back(std::make_unique<T>(std::forward<Args>(_args)...));
-	return static_cast<T const*>(instance().m_generalTypes.back().get());
+	if (auto it = _types.find(_key); it != _types.end())
+		return it->second.get();
+	// The type is only inserted after it has been constructed, since constructing it
+	// may request further types.
+	auto type = std::make_unique<T>(std::forward<Args>(_args)...);
+	return _types.emplace(std::move(_key), std::move(type)).first->second.get();
+}
+
+TypeProvider::FunctionOptionsKey TypeProvider::functionOptionsKey(FunctionType::Options const& _options)
+{
+	return {
+		_options.arbitraryParameters,
+		_options.gasSet,
+		_options.valueSet,
+		_options.saltSet,
+		_options.hasBoundFirstArgument
+	};
 }
 
 Type const* TypeProvider::fromElementaryTypeName(ElementaryTypeNameToken const& _type, std::optional<StateMutability> _stateMutability)
@@ -404,7 +416,7 @@ TupleType const* TypeProvider::tuple(std::vector<Type const*> members)
 	if (members.empty())
 		return &m_emptyTuple;
 
-	return createAndGet<TupleType>(std::move(members));
+	return createAndGet(instance().m_tupleTypes, members, std::move(members));
 }
 
 ReferenceType const* TypeProvider::withLocation(ReferenceType const* _type, DataLocation _location, bool _isPointer)
@@ -412,33 +424,37 @@ ReferenceType const* TypeProvider::withLocation(ReferenceType const* _type, Data
 	if (_type->location() == _location && _type->isPointer() == _isPointer)
 		return _type;
 
-	instance().m_generalTypes.emplace_back(_type->copyForLocation(_location, _isPointer));
-	return static_cast<ReferenceType const*>(instance().m_generalTypes.back().get());
+	auto& types = instance().m_referenceTypesWithLocation;
+	auto key = std::make_tuple(_type->richIdentifier(), _location, _isPointer);
+	auto it = types.find(key);
+	if (it == types.end())
+		it = types.emplace(std::move(key), _type->copyForLocation(_location, _isPointer)).first;
+	return it->second.get();
 }
 
 FunctionType const* TypeProvider::function(FunctionDefinition const& _function, FunctionType::Kind _kind)
 {
-	return createAndGet<FunctionType>(_function, _kind);
+	return createAndGet(instance().m_declaredFunctionTypes, {&_function, _kind}, _function, _kind);
 }
 
 FunctionType const* TypeProvider::function(VariableDeclaration const& _varDecl)
 {
-	return createAndGet<FunctionType>(_varDecl);
+	return createAndGet(instance().m_declaredFunctionTypes, {&_varDecl, FunctionType::Kind::Declaration}, _varDecl);
 }
 
 FunctionType const* TypeProvider::function(EventDefinition const& _def)
 {
-	return createAndGet<FunctionType>(_def);
+	return createAndGet(instance().m_declaredFunctionTypes, {&_def, FunctionType::Kind::Declaration}, _def);
 }
 
 FunctionType const* TypeProvider::function(ErrorDefinition const& _def)
 {
-	return createAndGet<FunctionType>(_def);
+	return createAndGet(instance().m_declaredFunctionTypes, {&_def, FunctionType::Kind::Declaration}, _def);
 }
 
 FunctionType const* TypeProvider::function(FunctionTypeName const& _typeName)
 {
-	return createAndGet<FunctionType>(_typeName);
+	return createAndGet(instance().m_declaredFunctionTypes, {&_typeName, FunctionType::Kind::Declaration}, _typeName);
 }
 
 FunctionType const* TypeProvider::function(
@@ -451,7 +467,9 @@ FunctionType const* TypeProvider::function(
 {
 	// Can only use this constructor for "arbitraryParameters".
 	solAssert(!_options.valueSet && !_options.gasSet && !_options.saltSet && !_options.hasBoundFirstArgument);
-	return createAndGet<FunctionType>(
+	return createAndGet(
+		instance().m_plainFunctionTypes,
+		{_parameterTypes, _returnParameterTypes, _kind, _stateMutability, functionOptionsKey(_options)},
 		_parameterTypes,
 		_returnParameterTypes,
 		_kind,
@@ -471,11 +489,22 @@ FunctionType const* TypeProvider::function(
 	FunctionType::Options _options
 )
 {
-	return createAndGet<FunctionType>(
+	return createAndGet(
+		instance().m_customFunctionTypes,
+		{
+			_parameterTypes,
+			_returnParameterTypes,
+			_parameterNames,
+			_returnParameterNames,
+			_kind,
+			_stateMutability,
+			_declaration,
+			functionOptionsKey(_options)
+		},
 		_parameterTypes,
 		_returnParameterTypes,
-		_parameterNames,
-		_returnParameterNames,
+		std::move(_parameterNames),
+		std::move(_returnParameterNames),
 		_kind,
 		_stateMutability,
 		_declaration,
@@ -485,7 +514,7 @@ FunctionType const* TypeProvider::function(
 
 RationalNumberType const* TypeProvider::rationalNumber(rational const& _value, Type const* _compatibleBytesType)
 {
-	return createAndGet<RationalNumberType>(_value, _compatibleBytesType);
+	return createAndGet(instance().m_rationalNumberTypes, {_value, _compatibleBytesType}, _value, _compatibleBytesType);
 }
 
 ArrayType const* TypeProvider::array(DataLocation _location, bool _isString)
@@ -504,52 +533,52 @@ ArrayType const* TypeProvider::array(DataLocation _location, bool _isString)
 		if (_location == DataLocation::Memory)
 			return bytesMemory();
 	}
-	return createAndGet<ArrayType>(_location, _isString);
+	return createAndGet(instance().m_byteArrayTypes, {_location, _isString}, _location, _isString);
 }
 
 ArrayType const* TypeProvider::array(DataLocation _location, Type const* _baseType)
 {
-	return createAndGet<ArrayType>(_location, _baseType);
+	return createAndGet(instance().m_dynamicArrayTypes, {_location, _baseType}, _location, _baseType);
 }
 
 ArrayType const* TypeProvider::array(DataLocation _location, Type const* _baseType, u256 const& _length)
 {
-	return createAndGet<ArrayType>(_location, _baseType, _length);
+	return createAndGet(instance().m_staticArrayTypes, {_location, _baseType, _length}, _location, _baseType, _length);
 }
 
 ArraySliceType const* TypeProvider::arraySlice(ArrayType const& _arrayType)
 {
-	return createAndGet<ArraySliceType>(_arrayType);
+	return createAndGet(instance().m_arraySliceTypes, &_arrayType, _arrayType);
 }
 
 ContractType const* TypeProvider::contract(ContractDefinition const& _contractDef, bool _isSuper)
 {
-	return createAndGet<ContractType>(_contractDef, _isSuper);
+	return createAndGet(instance().m_contractTypes, {&_contractDef, _isSuper}, _contractDef, _isSuper);
 }
 
 EnumType const* TypeProvider::enumType(EnumDefinition const& _enumDef)
 {
-	return createAndGet<EnumType>(_enumDef);
+	return createAndGet(instance().m_enumTypes, &_enumDef, _enumDef);
 }
 
 ModuleType const* TypeProvider::module(SourceUnit const& _source)
 {
-	return createAndGet<ModuleType>(_source);
+	return createAndGet(instance().m_moduleTypes, &_source, _source);
 }
 
 TypeType const* TypeProvider::typeType(Type const* _actualType)
 {
-	return createAndGet<TypeType>(_actualType);
+	return createAndGet(instance().m_typeTypes, _actualType, _actualType);
 }
 
 StructType const* TypeProvider::structType(StructDefinition const& _struct, DataLocation _location)
 {
-	return createAndGet<StructType>(_struct, _location);
+	return createAndGet(instance().m_structTypes, {&_struct, _location}, _struct, _location);
 }
 
 ModifierType const* TypeProvider::modifier(ModifierDefinition const& _def)
 {
-	return createAndGet<ModifierType>(_def);
+	return createAndGet(instance().m_modifierTypes, &_def, _def);
 }
 
 MagicType const* TypeProvider::magic(MagicType::Kind _kind)
@@ -568,15 +597,22 @@ MagicType const* TypeProvider::meta(Type const* _type)
 		),
 		"Only enum, contracts or integer types supported for now."
 	);
-	return createAndGet<MagicType>(_type);
+	return createAndGet(instance().m_metaTypes, _type, _type);
 }
 
 MappingType const* TypeProvider::mapping(Type const* _keyType, ASTString _keyName, Type const* _valueType, ASTString _valueName)
 {
-	return createAndGet<MappingType>(_keyType, _keyName, _valueType, _valueName);
+	return createAndGet(
+		instance().m_mappingTypes,
+		{_keyType, _keyName, _valueType, _valueName},
+		_keyType,
+		_keyName,
+		_valueType,
+		_valueName
+	);
 }
 
 UserDefinedValueType const* TypeProvider::userDefinedValueType(UserDefinedValueTypeDefinition const& _definition)
 {
-	return createAndGet<UserDefinedValueType>(_definition);
+	return createAndGet(instance().m_userDefinedValueTypes, &_definition, _definition);
 }
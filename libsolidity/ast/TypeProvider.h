@@ -24,7 +24,10 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <tuple>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace solidity::frontend
 {
@@ -109,6 +112,8 @@ public:
 
 	static TupleType const* emptyTuple() noexcept { return &m_emptyTuple; }
 
+	/// @returns @a _type with the given location and pointer flag.
+	/// Results are cached by the identifier of @a _type, so structurally equal types share a result.
 	static ReferenceType const* withLocation(ReferenceType const* _type, DataLocation _location, bool _isPointer);
 
 	/// @returns a copy of @a _type having the same location as this (and is not a pointer type)
@@ -207,8 +212,13 @@ private:
 		return _provider;
 	}
 
-	template <typename T, typename... Args>
-	static inline T const* createAndGet(Args&& ... _args);
+	/// @returns the type stored under @a _key in @a _types, after creating it from @a _args
+	/// if no type has been requested for this key before.
+	template <typename T, typename Key, typename... Args>
+	static inline T const* createAndGet(std::map<Key, std::unique_ptr<T>>& _types, std::type_identity_t<Key> _key, Args&& ... _args);
+
+	using FunctionOptionsKey = std::tuple<bool, bool, bool, bool, bool>;
+	static FunctionOptionsKey functionOptionsKey(FunctionType::Options const& _options);
 
 	static BoolType const m_boolean;
 	static InaccessibleDynamicType const m_inaccessibleDynamic;
@@ -231,7 +241,37 @@ private:
 	std::map<std::pair<unsigned, unsigned>, std::unique_ptr<FixedPointType>> m_ufixedMxN{};
 	std::map<std::pair<unsigned, unsigned>, std::unique_ptr<FixedPointType>> m_fixedMxN{};
 	std::map<std::string, std::unique_ptr<StringLiteralType>> m_stringLiteralTypes{};
-	std::vector<std::unique_ptr<Type>> m_generalTypes{};
+
+	/// The remaining types are interned by the arguments of the factory function that created them,
+	/// so that repeated requests for the same type return the same instance and share its caches.
+	std::map<std::pair<DataLocation, bool>, std::unique_ptr<ArrayType>> m_byteArrayTypes{};
+	std::map<std::pair<DataLocation, Type const*>, std::unique_ptr<ArrayType>> m_dynamicArrayTypes{};
+	std::map<std::tuple<DataLocation, Type const*, u256>, std::unique_ptr<ArrayType>> m_staticArrayTypes{};
+	std::map<ArrayType const*, std::unique_ptr<ArraySliceType>> m_arraySliceTypes{};
+	std::map<std::vector<Type const*>, std::unique_ptr<TupleType>> m_tupleTypes{};
+	/// Keyed by the rich identifier of the original type, which determines the copy completely.
+	std::map<std::tuple<std::string, DataLocation, bool>, std::unique_ptr<ReferenceType>> m_referenceTypesWithLocation{};
+	/// Function types of function definitions, accessors, events, errors and function type names,
+	/// keyed by the AST node and, for function definitions, the requested kind.
+	std::map<std::pair<ASTNode const*, FunctionType::Kind>, std::unique_ptr<FunctionType>> m_declaredFunctionTypes{};
+	std::map<
+		std::tuple<strings, strings, FunctionType::Kind, StateMutability, FunctionOptionsKey>,
+		std::unique_ptr<FunctionType>
+	> m_plainFunctionTypes{};
+	std::map<
+		std::tuple<TypePointers, TypePointers, strings, strings, FunctionType::Kind, StateMutability, Declaration const*, FunctionOptionsKey>,
+		std::unique_ptr<FunctionType>
+	> m_customFunctionTypes{};
+	std::map<std::pair<rational, Type const*>, std::unique_ptr<RationalNumberType>> m_rationalNumberTypes{};
+	std::map<std::pair<ContractDefinition const*, bool>, std::unique_ptr<ContractType>> m_contractTypes{};
+	std::map<EnumDefinition const*, std::unique_ptr<EnumType>> m_enumTypes{};
+	std::map<SourceUnit const*, std::unique_ptr<ModuleType>> m_moduleTypes{};
+	std::map<Type const*, std::unique_ptr<TypeType>> m_typeTypes{};
+	std::map<std::pair<StructDefinition const*, DataLocation>, std::unique_ptr<StructType>> m_structTypes{};
+	std::map<ModifierDefinition const*, std::unique_ptr<ModifierType>> m_modifierTypes{};
+	std::map<Type const*, std::unique_ptr<MagicType>> m_metaTypes{};
+	std::map<std::tuple<Type const*, ASTString, Type const*, ASTString>, std::unique_ptr<MappingType>> m_mappingTypes{};
+	std::map<UserDefinedValueTypeDefinition const*, std::unique_ptr<UserDefinedValueType>> m_userDefinedValueTypes{};
 };
 
 }
@@ -1710,6 +1710,8 @@ bool ArrayType::operator==(Type const& _other) const
 
 bool ArrayType::operator==(ArrayType const& _other) const
 {
+	if (this == &_other)
+		return true;
 	if (
 		!equals(_other) ||
 		_other.isByteArray() != isByteArray() ||
@@ -3144,6 +3146,8 @@ bool FunctionType::operator==(Type const& _other) const
 	if (_other.category() != category())
 		return false;
 	FunctionType const& other = dynamic_cast<FunctionType const&>(_other);
+	if (this == &other)
+		return true;
 	if (!equalExcludingStateMutability(other))
 		return false;
 	if (m_stateMutability != other.stateMutability())
@@ -3855,6 +3859,8 @@ bool MappingType::operator==(Type const& _other) const
 	if (_other.category() != category())
 		return false;
 	MappingType const& other = dynamic_cast<MappingType const&>(_other);
+	if (this == &other)
+		return true;
 	return *other.m_keyType == *m_keyType && *other.m_valueType == *m_valueType;
 }
 
@@ -3906,6 +3912,8 @@ bool TypeType::operator==(Type const& _other) const
 	if (_other.category() != category())
 		return false;
 	TypeType const& other = dynamic_cast<TypeType const&>(_other);
+	if (this == &other)
+		return true;
 	return *actualType() == *other.actualType();
 }
 
@@ -2849,7 +2849,7 @@ std::string YulUtilFunctions::readFromStorageReferenceType(Type const& _type)
 	{
 		solAssert(arrayType->dataStoredIn(DataLocation::Memory), "");
 		return copyArrayFromStorageToMemoryFunction(
-			dynamic_cast<ArrayType const&>(*arrayType->copyForLocation(DataLocation::Storage, false)),
+			dynamic_cast<ArrayType const&>(*TypeProvider::withLocation(arrayType, DataLocation::Storage, false)),
 			*arrayType
 		);
 	}
@@ -1898,7 +1898,13 @@ CHCSolverInterface::QueryResult CHC::query(smtutil::Expression const& _query, la
 		return {.answer = CheckResult::UNKNOWN, .invariant = smtutil::Expression(true), .cex = {}};
 	}
 	auto result = m_interface->query(_query);
-	switch (result.answer)
+	reportSolverIssues(result.answer, _location);
+	return result;
+}
+
+void CHC::reportSolverIssues(CheckResult _answer, langutil::SourceLocation const& _location)
+{
+	switch (_answer)
 	{
 	case CheckResult::SATISFIABLE:
 	case CheckResult::UNSATISFIABLE:
@@ -1911,7 +1917,6 @@ CHCSolverInterface::QueryResult CHC::query(smtutil::Expression const& _query, la
 		m_errorReporter.warning(1218_error, _location, "CHC: Error during interaction with the solver.");
 		break;
 	}
-	return result;
 }
 
 void CHC::verificationTargetEncountered(
@@ -2014,14 +2019,18 @@ void CHC::checkVerificationTargets()
 	}
 
 	std::set<unsigned> checkedErrorIds;
-	for (auto const& [targetId, placeholders]: targetEntryPoints)
-	{
-		auto const& target = m_verificationTargets.at(targetId);
-		auto [errorType, errorReporterId] = targetDescription(target);
+	if (m_settings.solverWorkers > 1 && !m_settings.printQuery)
+		checkAndReportTargetsConcurrently(targetEntryPoints);
+	else
+		for (auto const& [targetId, placeholders]: targetEntryPoints)
+		{
+			auto const& target = m_verificationTargets.at(targetId);
+			auto [errorType, errorReporterId] = targetDescription(target);
 
-		checkAndReportTarget(target, placeholders, errorReporterId, errorType + " happens here.", errorType + " might happen here.");
-		checkedErrorIds.insert(target.errorId);
-	}
+			checkAndReportTarget(target, placeholders, errorReporterId, errorType + " happens here.", errorType + " might happen here.");
+		}
+	for (unsigned targetId: targetEntryPoints | ranges::views::keys)
+		checkedErrorIds.insert(m_verificationTargets.at(targetId).errorId);
 
 	auto toReport = m_unsafeTargets;
 	if (m_settings.showUnproved)
@@ -2145,6 +2154,58 @@ void CHC::checkAndReportTarget(
 	if (m_unsafeTargets.count(_target.errorNode) && m_unsafeTargets.at(_target.errorNode).count(_target.type))
 		return;
 
+	smtutil::Expression errorBlock = createTargetQuery(_target, _placeholders);
+	reportTarget(
+		_target,
+		query(errorBlock, _target.errorNode->location()),
+		errorBlock.name,
+		_errorReporterId,
+		std::move(_satMsg),
+		std::move(_unknownMsg)
+	);
+}
+
+void CHC::checkAndReportTargetsConcurrently(std::map<unsigned, std::vector<CHCQueryPlaceholder>> const& _targetEntryPoints)
+{
+	// All error blocks are connected before the first query, so that every query is posed
+	// against the same system of rules, which is then serialized only once.
+	std::vector<unsigned> targetIds;
+	std::vector<smtutil::Expression> errorBlocks;
+	for (auto const& [targetId, placeholders]: _targetEntryPoints)
+	{
+		targetIds.push_back(targetId);
+		errorBlocks.push_back(createTargetQuery(m_verificationTargets.at(targetId), placeholders));
+	}
+
+	auto results = m_interface->batchQuery(errorBlocks, m_settings.solverWorkers);
+	solAssert(results.size() == targetIds.size());
+
+	// The results are reported in the same order as in the sequential mode,
+	// so that the output does not depend on the number of workers.
+	for (size_t i = 0; i < targetIds.size(); ++i)
+	{
+		auto const& target = m_verificationTargets.at(targetIds[i]);
+		if (m_unsafeTargets.count(target.errorNode) && m_unsafeTargets.at(target.errorNode).count(target.type))
+			continue;
+
+		reportSolverIssues(results[i].answer, target.errorNode->location());
+		auto [errorType, errorReporterId] = targetDescription(target);
+		reportTarget(
+			target,
+			std::move(results[i]),
+			errorBlocks[i].name,
+			errorReporterId,
+			errorType + " happens here.",
+			errorType + " might happen here."
+		);
+	}
+}
+
+smtutil::Expression CHC::createTargetQuery(
+	CHCVerificationTarget const& _target,
+	std::vector<CHCQueryPlaceholder> const& _placeholders
+)
+{
 	createErrorBlock();
 	for (auto const& placeholder: _placeholders)
 		connectBlocks(
@@ -2152,8 +2213,20 @@ void CHC::checkAndReportTarget(
 			error(),
 			placeholder.constraints && placeholder.errorExpression == _target.errorId
 		);
+	return error();
+}
+
+void CHC::reportTarget(
+	CHCVerificationTarget const& _target,
+	CHCSolverInterface::QueryResult _result,
+	std::string const& _errorBlockName,
+	ErrorId _errorReporterId,
+	std::string _satMsg,
+	std::string _unknownMsg
+)
+{
 	auto const& location = _target.errorNode->location();
-	auto [result, invariant, model] = query(error(), location);
+	auto&& [result, invariant, model] = _result;
 	if (result == CheckResult::UNSATISFIABLE)
 	{
 		m_safeTargets[_target.errorNode].insert(_target);
@@ -2175,7 +2248,7 @@ void CHC::checkAndReportTarget(
 			if (it->second.empty())
 				m_safeTargets.erase(it);
 		}
-		auto cex = generateCounterexample(model, error().name);
+		auto cex = generateCounterexample(model, _errorBlockName);
 		if (cex)
 			m_unsafeTargets[_target.errorNode][_target.type] = {
 				_errorReporterId,
@@ -297,6 +297,8 @@ private:
 	/// @returns <true, invariant, empty> if query is unsatisfiable (safe).
 	/// @returns <false, Expression(true), model> otherwise.
 	smtutil::CHCSolverInterface::QueryResult query(smtutil::Expression const& _query, langutil::SourceLocation const& _location);
+	/// Warns if the solver answered with an error or conflicting results.
+	void reportSolverIssues(smtutil::CheckResult _answer, langutil::SourceLocation const& _location);
 
 	void verificationTargetEncountered(ASTNode const* const _errorNode, VerificationTargetType _type, smtutil::Expression const& _errorCondition);
 
@@ -310,6 +312,24 @@ private:
 		std::string _satMsg,
 		std::string _unknownMsg = ""
 	);
+	/// Checks all targets with a single batch of queries that the solver interface
+	/// may run concurrently, and reports them in the same order as checkAndReportTarget would.
+	void checkAndReportTargetsConcurrently(std::map<unsigned, std::vector<CHCQueryPlaceholder>> const& _targetEntryPoints);
+	/// Creates a new error block reachable from all entry points of @a _target.
+	/// @returns the error block, whose reachability is the query for @a _target.
+	smtutil::Expression createTargetQuery(
+		CHCVerificationTarget const& _target,
+		std::vector<CHCQueryPlaceholder> const& _placeholders
+	);
+	/// Records the solver's @a _result for @a _target as safe, unsafe or unproved.
+	void reportTarget(
+		CHCVerificationTarget const& _target,
+		smtutil::CHCSolverInterface::QueryResult _result,
+		std::string const& _errorBlockName,
+		langutil::ErrorId _errorReporterId,
+		std::string _satMsg,
+		std::string _unknownMsg
+	);
 
 	std::pair<std::string, langutil::ErrorId> targetDescription(CHCVerificationTarget const& _target);
 
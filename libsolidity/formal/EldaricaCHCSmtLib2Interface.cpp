@@ -30,10 +30,21 @@ EldaricaCHCSmtLib2Interface::EldaricaCHCSmtLib2Interface(
 {
 }
 
-std::string EldaricaCHCSmtLib2Interface::querySolver(std::string const& _input)
+void EldaricaCHCSmtLib2Interface::setupSmtCallback()
 {
 	if (auto* universalCallback = m_smtCallback.target<frontend::UniversalCallback>())
 		universalCallback->smtCommand().setEldarica(m_queryTimeout, m_computeInvariants);
+}
 
+std::string EldaricaCHCSmtLib2Interface::querySolver(std::string const& _input)
+{
+	setupSmtCallback();
 	return CHCSmtLib2Interface::querySolver(_input);
 }
+
+std::vector<std::string> EldaricaCHCSmtLib2Interface::querySolver(std::vector<std::string> const& _inputs, unsigned _workers)
+{
+	// The solver command is configured before any worker starts, so it is not modified during concurrent use.
+	setupSmtCallback();
+	return CHCSmtLib2Interface::querySolver(_inputs, _workers);
+}
@@ -33,7 +33,10 @@ public:
 	);
 
 private:
+	void setupSmtCallback();
+
 	std::string querySolver(std::string const& _input) override;
+	std::vector<std::string> querySolver(std::vector<std::string> const& _inputs, unsigned _workers) override;
 
 	bool m_computeInvariants;
 };
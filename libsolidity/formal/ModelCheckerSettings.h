@@ -174,6 +174,11 @@ struct ModelCheckerSettings
 	bool showUnproved = false;
 	bool showUnsupported = false;
 	smtutil::SMTSolverChoice solvers = smtutil::SMTSolverChoice::Z3();
+	/// Upper bound for @a solverWorkers. Every worker runs its own solver process.
+	static constexpr unsigned MaxSolverWorkers = 256;
+	/// Number of CHC queries that may be solved concurrently by separate solver processes.
+	/// Between 1 and @a MaxSolverWorkers.
+	unsigned solverWorkers = 1;
 	ModelCheckerTargets targets = ModelCheckerTargets::Default();
 	std::optional<unsigned> timeout; // in milliseconds
 
@@ -192,6 +197,7 @@ struct ModelCheckerSettings
 			showUnproved == _other.showUnproved &&
 			showUnsupported == _other.showUnsupported &&
 			solvers == _other.solvers &&
+			solverWorkers == _other.solverWorkers &&
 			targets == _other.targets &&
 			timeout == _other.timeout;
 	}
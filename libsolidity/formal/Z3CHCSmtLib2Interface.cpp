@@ -22,6 +22,8 @@
 
 #include <libsmtutil/SMTLib2Parser.h>
 
+#include <libsolutil/CommonData.h>
+
 #include <boost/algorithm/string/predicate.hpp>
 
 #include <stack>
@@ -79,7 +81,7 @@ CHCSolverInterface::QueryResult Z3CHCSmtLib2Interface::query(smtutil::Expression
 		{
 			// Repeat the query with preprocessing disabled, to get the full proof
 			setupSmtCallback(false);
-			query = "(set-option :produce-proofs true)" + query + "\n(get-proof)";
+			query = proofQuery(query);
 #ifdef EMSCRIPTEN_BUILD
 			z3::set_param("fp.xform.slice", false);
 			z3::set_param("fp.xform.inline_linear", false);
@@ -89,23 +91,10 @@ CHCSolverInterface::QueryResult Z3CHCSmtLib2Interface::query(smtutil::Expression
 			response = querySolver(query);
 #endif
 			setupSmtCallback(true);
-			if (!boost::starts_with(response, "unsat"))
-				return {CheckResult::SATISFIABLE, Expression(true), {}};
-			return {CheckResult::SATISFIABLE, Expression(true), graphFromZ3Answer(response)};
-		}
-
-		CheckResult result;
-		if (boost::starts_with(response, "sat"))
-		{
-			auto maybeInvariants = invariantsFromSolverResponse(response);
-			return {CheckResult::UNSATISFIABLE, maybeInvariants.value_or(Expression(true)), {}};
+			return resultFromProof(response);
 		}
-		else if (boost::starts_with(response, "unknown"))
-			result = CheckResult::UNKNOWN;
-		else
-			result = CheckResult::ERROR;
 
-		return {result, Expression(true), {}};
+		return resultFromResponse(response);
 	}
 	catch(smtutil::SMTSolverInteractionError const&)
 	{
@@ -113,6 +102,68 @@ CHCSolverInterface::QueryResult Z3CHCSmtLib2Interface::query(smtutil::Expression
 	}
 }
 
+std::vector<CHCSolverInterface::QueryResult> Z3CHCSmtLib2Interface::batchQuery(std::vector<smtutil::Expression> const& _blocks, unsigned _workers)
+{
+#ifdef EMSCRIPTEN_BUILD
+	// The in-process solver cannot be used concurrently, the queries are solved one by one.
+	return CHCSolverInterface::batchQuery(_blocks, _workers);
+#else
+	std::string const& rules = m_commands.toString();
+	auto queries = solidity::util::applyMap(_blocks, [&](smtutil::Expression const& _block) { return dumpQuery(rules, _block); });
+
+	setupSmtCallback(true);
+	std::vector<std::string> responses = querySolver(queries, _workers);
+
+	// Repeat the unsafe queries with preprocessing disabled, to get the full proofs.
+	// All of them are sent at once, so that the solver command does not change while queries are running.
+	std::vector<bool> unsafe(responses.size(), false);
+	std::vector<std::string> proofQueries;
+	for (size_t i = 0; i < responses.size(); ++i)
+		if (boost::starts_with(responses[i], "unsat"))
+		{
+			unsafe[i] = true;
+			proofQueries.emplace_back(proofQuery(queries[i]));
+		}
+	if (!proofQueries.empty())
+	{
+		setupSmtCallback(false);
+		std::vector<std::string> proofs = querySolver(proofQueries, _workers);
+		setupSmtCallback(true);
+		for (size_t i = 0, proofIndex = 0; i < responses.size(); ++i)
+			if (unsafe[i])
+				responses[i] = std::move(proofs[proofIndex++]);
+	}
+
+	std::vector<QueryResult> results;
+	for (size_t i = 0; i < responses.size(); ++i)
+		try
+		{
+			if (unsafe[i])
+				results.emplace_back(resultFromProof(responses[i]));
+			else
+				results.emplace_back(resultFromResponse(responses[i]));
+		}
+		catch(smtutil::SMTSolverInteractionError const&)
+		{
+			results.push_back({CheckResult::ERROR, Expression(true), {}});
+		}
+	return results;
+#endif
+}
+
+std::string Z3CHCSmtLib2Interface::proofQuery(std::string const& _query)
+{
+	return "(set-option :produce-proofs true)" + _query + "\n(get-proof)";
+}
+
+CHCSolverInterface::QueryResult Z3CHCSmtLib2Interface::resultFromProof(std::string const& _response) const
+{
+	// The original query was unsat, i.e., the target is reachable, so the answer is flipped to SATISFIABLE in any case.
+	// The counterexample is only available if the repeated query is still unsat.
+	if (!boost::starts_with(_response, "unsat"))
+		return {CheckResult::SATISFIABLE, Expression(true), {}};
+	return {CheckResult::SATISFIABLE, Expression(true), graphFromZ3Answer(_response)};
+}
 
 CHCSolverInterface::CexGraph Z3CHCSmtLib2Interface::graphFromZ3Answer(std::string const& _proof) const
 {
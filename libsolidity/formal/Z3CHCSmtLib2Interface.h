@@ -37,6 +37,16 @@ private:
 
 	CHCSolverInterface::QueryResult query(smtutil::Expression const& _expr) override;
 
+	/// Sends all queries with preprocessing enabled first, and then repeats the unsafe ones
+	/// with preprocessing disabled to obtain the counterexamples.
+	std::vector<CHCSolverInterface::QueryResult> batchQuery(std::vector<smtutil::Expression> const& _exprs, unsigned _workers) override;
+
+	/// @returns the query that asks Z3 for the proof of unsatisfiability of @a _query.
+	static std::string proofQuery(std::string const& _query);
+
+	/// @returns the result for a reachable target given the response to its proof query.
+	CHCSolverInterface::QueryResult resultFromProof(std::string const& _response) const;
+
 	CHCSolverInterface::CexGraph graphFromZ3Answer(std::string const& _proof) const;
 
 	static CHCSolverInterface::CexGraph graphFromSMTLib2Expression(
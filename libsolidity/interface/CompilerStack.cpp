@@ -25,6 +25,7 @@
 
 #include <libsolidity/interface/CompilerStack.h>
 #include <libsolidity/interface/ImportRemapper.h>
+#include <libsolidity/interface/ParsedSourceCache.h>
 
 #include <libsolidity/analysis/ControlFlowAnalyzer.h>
 #include <libsolidity/analysis/ControlFlowGraph.h>
@@ -47,6 +48,7 @@
 #include <libsolidity/ast/AST.h>
 #include <libsolidity/ast/TypeProvider.h>
 #include <libsolidity/ast/ASTJsonImporter.h>
+#include <libsolidity/ast/ASTUtils.h>
 #include <libsolidity/codegen/Compiler.h>
 #include <libsolidity/formal/ModelChecker.h>
 #include <libsolidity/interface/ABI.h>
@@ -84,10 +86,12 @@
 #include <libsolutil/JSON.h>
 #include <libsolutil/Algorithms.h>
 #include <libsolutil/FunctionSelector.h>
+#include <libsolutil/Parallel.h>
 
 #include <boost/algorithm/string/replace.hpp>
 
 #include <range/v3/algorithm/all_of.hpp>
+#include <range/v3/range/conversion.hpp>
 #include <range/v3/view/concat.hpp>
 #include <range/v3/view/map.hpp>
 
@@ -329,6 +333,7 @@ void CompilerStack::reset(bool _keepSettings)
 		m_metadataHash = MetadataHash::IPFS;
 		m_stopAfter = State::CompilationSuccessful;
 		m_compilationSourceType = CompilationSourceType::Solidity;
+		m_workers = 1;
 	}
 	m_experimentalAnalysis.reset();
 	m_globalContext.reset();
@@ -338,15 +343,70 @@ void CompilerStack::reset(bool _keepSettings)
 	TypeProvider::reset();
 }
 
+void CompilerStack::setParsedSourceCache(std::shared_ptr<ParsedSourceCache> _parsedSourceCache)
+{
+	solAssert(m_stackState < ParsedAndImported, "Must set parsed source cache before parsing.");
+	m_parsedSourceCache = std::move(_parsedSourceCache);
+}
+
+void CompilerStack::setWorkers(size_t _workers)
+{
+	solAssert(m_stackState < ParsedAndImported, "Must set the number of workers before parsing.");
+	solAssert(_workers > 0);
+	m_workers = _workers;
+}
+
 void CompilerStack::setSources(StringMap _sources)
 {
 	solAssert(m_stackState != SourcesSet, "Cannot change sources once set.");
 	solAssert(m_stackState == Empty, "Must set sources before parsing.");
-	for (auto source: _sources)
-		m_sources[source.first].charStream = std::make_unique<CharStream>(/*content*/std::move(source.second), /*name*/source.first);
+	for (auto&& [name, content]: _sources)
+		m_sources[name].charStream = std::make_unique<CharStream>(/*content*/std::move(content), /*name*/name);
 	m_stackState = SourcesSet;
 }
 
+std::vector<CompilerStack::ParsedSource> CompilerStack::parseSources(std::vector<std::string> const& _sourceUnitNames)
+{
+	std::vector<ParsedSource> parsedSources(_sourceUnitNames.size());
+	std::vector<size_t> sourcesToParse;
+	for (size_t i = 0; i < _sourceUnitNames.size(); ++i)
+	{
+		if (m_parsedSourceCache)
+			if (auto const* cachedSource = m_parsedSourceCache->lookup(
+				_sourceUnitNames[i],
+				m_sources.at(_sourceUnitNames[i]).keccak256(),
+				{m_evmVersion, m_eofVersion}
+			))
+			{
+				parsedSources[i].ast = cachedSource->ast;
+				parsedSources[i].idCount = cachedSource->idCount;
+				parsedSources[i].diagnostics = cachedSource->diagnostics;
+				parsedSources[i].cached = true;
+				continue;
+			}
+		sourcesToParse.push_back(i);
+	}
+
+	// Every source gets its own parser and error reporter, so that nothing is shared between threads.
+	util::parallelFor(sourcesToParse.size(), m_workers, [&](size_t _index) {
+		size_t const sourceIndex = sourcesToParse[_index];
+		ParsedSource& parsedSource = parsedSources[sourceIndex];
+		ErrorReporter errorReporter(parsedSource.diagnostics);
+		Parser parser{errorReporter, m_evmVersion, m_eofVersion};
+		try
+		{
+			parsedSource.ast = parser.parse(*m_sources.at(_sourceUnitNames[sourceIndex]).charStream);
+		}
+		catch (...)
+		{
+			parsedSource.exception = std::current_exception();
+		}
+		parsedSource.idCount = parser.maxID();
+	});
+
+	return parsedSources;
+}
+
 bool CompilerStack::parse()
 {
 	solAssert(m_stackState == SourcesSet, "Must call parse only after the SourcesSet state.");
@@ -357,53 +417,97 @@ bool CompilerStack::parse()
 
 	try
 	{
-		Parser parser{m_errorReporter, m_evmVersion, m_eofVersion};
-
 		std::vector<std::string> sourcesToParse;
 		for (auto const& s: m_sources)
 			sourcesToParse.push_back(s.first);
 
-		for (size_t i = 0; i < sourcesToParse.size(); ++i)
+		int64_t maxID = 0;
+		for (size_t nextSource = 0; nextSource < sourcesToParse.size();)
 		{
-			std::string const& path = sourcesToParse[i];
-			Source& source = m_sources[path];
-			source.ast = parser.parse(*source.charStream);
-			if (!source.ast)
-				solAssert(Error::containsErrors(m_errorReporter.errors()), "Parser returned null but did not report error.");
-			else
+			// All the sources discovered so far are parsed at once. The results are then processed in order,
+			// so that node IDs and diagnostics are the same as when parsing the sources one after another.
+			// A source unit that has to be parsed again starts a new batch.
+			std::vector<std::string> batch;
+			std::set<std::string> batchNames;
+			for (; nextSource < sourcesToParse.size() && batchNames.insert(sourcesToParse[nextSource]).second; ++nextSource)
+				batch.push_back(sourcesToParse[nextSource]);
+
+			std::vector<ParsedSource> parsedSources = parseSources(batch);
+			for (size_t i = 0; i < batch.size(); ++i)
 			{
-				source.ast->annotation().path = path;
-
-				for (auto const& import: ASTNode::filteredNodes<ImportDirective>(source.ast->nodes()))
+				std::string const& path = batch[i];
+				Source& source = m_sources[path];
+				ParsedSource& parsedSource = parsedSources[i];
+				try
 				{
-					solAssert(!import->path().empty(), "Import path cannot be empty.");
-					// Check whether the import directive is for the standard library,
-					// and if yes, add specified file to source units to be parsed.
-					auto it = stdlib::sources.find(import->path());
-					if (it != stdlib::sources.end())
-					{
-						auto [name, content] = *it;
-						m_sources[name].charStream = std::make_unique<CharStream>(content, name);
-						sourcesToParse.push_back(name);
-					}
+					m_errorReporter.merge(parsedSource.diagnostics);
+				}
+				catch (FatalError const&)
+				{
+					// Too many errors. Like the parser, continue with the next source.
+				}
+				if (parsedSource.exception)
+					std::rethrow_exception(parsedSource.exception);
 
-					// The current value of `path` is the absolute path as seen from this source file.
-					// We first have to apply remappings before we can store the actual absolute path
-					// as seen globally.
-					import->annotation().absolutePath = applyRemapping(util::absolutePath(
-						import->path(),
-						path
-					), path);
+				source.ast = std::move(parsedSource.ast);
+				if (source.ast)
+				{
+					// Each source was parsed with IDs starting from zero, cached ones possibly with a different offset.
+					int64_t const firstID = parsedSource.cached ? source.ast->id() - parsedSource.idCount : 0;
+					shiftNodeIDs(*source.ast, maxID - firstID);
+					// Experimental analysis keeps its own per-node state, so such sources are not reused.
+					if (
+						m_parsedSourceCache &&
+						!parsedSource.cached &&
+						!source.ast->experimentalSolidity() &&
+						!Error::containsErrors(parsedSource.diagnostics)
+					)
+						m_parsedSourceCache->store(
+							path,
+							source.keccak256(),
+							{m_evmVersion, m_eofVersion},
+							{source.ast, parsedSource.idCount, std::move(parsedSource.diagnostics)}
+						);
 				}
+				maxID += parsedSource.idCount;
 
-				if (m_stopAfter >= ParsedAndImported)
-					for (auto const& newSource: loadMissingSources(*source.ast))
+				if (!source.ast)
+					solAssert(Error::containsErrors(m_errorReporter.errors()), "Parser returned null but did not report error.");
+				else
+				{
+					source.ast->annotation().path = path;
+
+					for (auto const& import: ASTNode::filteredNodes<ImportDirective>(source.ast->nodes()))
 					{
-						std::string const& newPath = newSource.first;
-						std::string const& newContents = newSource.second;
-						m_sources[newPath].charStream = std::make_shared<CharStream>(newContents, newPath);
-						sourcesToParse.push_back(newPath);
+						solAssert(!import->path().empty(), "Import path cannot be empty.");
+						// Check whether the import directive is for the standard library,
+						// and if yes, add specified file to source units to be parsed.
+						auto it = stdlib::sources.find(import->path());
+						if (it != stdlib::sources.end())
+						{
+							auto [name, content] = *it;
+							m_sources[name].charStream = std::make_unique<CharStream>(content, name);
+							sourcesToParse.push_back(name);
+						}
+
+						// The current value of `path` is the absolute path as seen from this source file.
+						// We first have to apply remappings before we can store the actual absolute path
+						// as seen globally.
+						import->annotation().absolutePath = applyRemapping(util::absolutePath(
+							import->path(),
+							path
+						), path);
 					}
+
+					if (m_stopAfter >= ParsedAndImported)
+						for (auto const& newSource: loadMissingSources(*source.ast))
+						{
+							std::string const& newPath = newSource.first;
+							std::string const& newContents = newSource.second;
+							m_sources[newPath].charStream = std::make_shared<CharStream>(newContents, newPath);
+							sourcesToParse.push_back(newPath);
+						}
+				}
 			}
 		}
 
@@ -414,7 +518,7 @@ bool CompilerStack::parse()
 		storeContractDefinitions();
 
 		solAssert(!m_maxAstId.has_value());
-		m_maxAstId = parser.maxID();
+		m_maxAstId = maxID;
 	}
 	catch (UnimplementedFeatureError const& _error)
 	{
@@ -425,22 +529,23 @@ bool CompilerStack::parse()
 	return true;
 }
 
-void CompilerStack::importASTs(std::map<std::string, Json> const& _sources)
+void CompilerStack::importASTs(std::map<std::string, Json> _sources)
 {
 	solAssert(m_stackState == Empty, "Must call importASTs only before the SourcesSet state.");
-	std::map<std::string, ASTPointer<SourceUnit>> reconstructedSources =
-		ASTJsonImporter(m_evmVersion, m_eofVersion).jsonToSourceUnit(_sources);
-	for (auto& src: reconstructedSources)
+	ASTJsonImporter importer(m_evmVersion, m_eofVersion);
+	importer.declareSources(_sources | ranges::views::keys | ranges::to<std::vector<std::string>>);
+	for (auto& [path, json]: _sources)
 	{
-		solUnimplementedAssert(!src.second->experimentalSolidity());
-		std::string const& path = src.first;
 		Source source;
-		source.ast = src.second;
+		source.ast = importer.jsonToSourceUnit(json, path);
+		solUnimplementedAssert(!source.ast->experimentalSolidity());
 		source.charStream = std::make_shared<CharStream>(
-			util::jsonCompactPrint(_sources.at(src.first)),
-			src.first,
+			util::jsonCompactPrint(json),
+			path,
 			true // imported from AST
 		);
+		// The DOM of this source is not needed anymore.
+		json = Json();
 		m_sources[path] = std::move(source);
 	}
 	m_stackState = ParsedAndImported;
@@ -624,7 +729,7 @@ bool CompilerStack::analyzeLegacy(bool _noErrorsSoFar)
 			ControlFlowRevertPruner pruner(cfg);
 			pruner.run();
 
-			ControlFlowAnalyzer controlFlowAnalyzer(cfg, m_errorReporter);
+			ControlFlowAnalyzer controlFlowAnalyzer(cfg, m_errorReporter, m_workers);
 			if (!controlFlowAnalyzer.run())
 				noErrors = false;
 		}
@@ -51,6 +51,7 @@
 
 #include <libyul/ObjectOptimizer.h>
 
+#include <exception>
 #include <functional>
 #include <memory>
 #include <ostream>
@@ -88,6 +89,7 @@ class Compiler;
 class GlobalContext;
 class Natspec;
 class DeclarationContainer;
+class ParsedSourceCache;
 namespace experimental
 {
 class Analysis;
@@ -255,6 +257,14 @@ public:
 	/// Select components of debug info that should be included in comments in generated assembly.
 	void selectDebugInfo(langutil::DebugInfoSelection _debugInfoSelection);
 
+	/// Sets a cache of parsed source units, possibly shared with earlier instances.
+	/// Sources found in it are not parsed again. Kept by reset(). Must be set before parsing.
+	void setParsedSourceCache(std::shared_ptr<ParsedSourceCache> _parsedSourceCache);
+
+	/// Sets the maximum number of threads used to parse sources and to analyze control flow.
+	/// Defaults to 1, i.e. everything runs on the calling thread. Must be set before parsing.
+	void setWorkers(size_t _workers);
+
 	/// Sets the sources. Must be set before parsing.
 	void setSources(StringMap _sources);
 
@@ -267,8 +277,10 @@ public:
 	bool parse();
 
 	/// Imports given SourceUnits so they can be analyzed. Leads to the same internal state as parse().
+	/// The JSON of each source is released as soon as it has been imported, so only the not yet
+	/// imported sources and the already reconstructed ones are held in memory at the same time.
 	/// Will throw errors if the import fails
-	void importASTs(std::map<std::string, Json> const& _sources);
+	void importASTs(std::map<std::string, Json> _sources);
 
 	/// Performs the analysis steps (imports, scopesetting, syntaxCheck, referenceResolving,
 	///  typechecking, staticAnalysis) on previously parsed sources.
@@ -472,6 +484,24 @@ private:
 	void createAndAssignCallGraphs();
 	void findAndReportCyclicContractDependencies();
 
+	/// Result of parsing a single source unit with node IDs starting from zero
+	/// or of taking it from @a m_parsedSourceCache.
+	struct ParsedSource
+	{
+		std::shared_ptr<SourceUnit> ast;
+		/// Number of node IDs assigned by the parser.
+		int64_t idCount = 0;
+		langutil::ErrorList diagnostics;
+		bool cached = false;
+		/// Exception thrown by the parser, to be rethrown once the preceding sources have been processed.
+		std::exception_ptr exception;
+	};
+
+	/// Parses the given (distinct) source units concurrently, each with its own parser and error reporter,
+	/// unless their ASTs can be taken from @a m_parsedSourceCache.
+	/// @returns the results in the order of @a _sourceUnitNames.
+	std::vector<ParsedSource> parseSources(std::vector<std::string> const& _sourceUnitNames);
+
 	/// Loads the missing sources from @a _ast (named @a _path) using the callback
 	/// @a m_readFile
 	/// @returns the newly loaded sources.
@@ -621,6 +651,8 @@ private:
 	std::vector<Source const*> m_sourceOrder;
 	std::map<std::string const, Contract> m_contracts;
 	std::shared_ptr<yul::ObjectOptimizer> m_objectOptimizer;
+	std::shared_ptr<ParsedSourceCache> m_parsedSourceCache;
+	size_t m_workers = 1;
 
 	langutil::ErrorList m_errorList;
 	langutil::ErrorReporter m_errorReporter;
@@ -0,0 +1,96 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolidity/interface/ParsedSourceCache.h>
+
+#include <libsolidity/ast/AST.h>
+#include <libsolidity/ast/ASTVisitor.h>
+
+#include <libsolutil/Keccak256.h>
+
+using namespace solidity;
+using namespace solidity::frontend;
+using namespace solidity::langutil;
+using namespace solidity::util;
+
+namespace
+{
+
+/// Clears everything that analysis and code generation store in an AST,
+/// bringing it back to the state it was in right after parsing.
+class AnnotationResetter: public ASTVisitor
+{
+private:
+	bool visit(ContractDefinition& _contract) override
+	{
+		_contract.resetCaches();
+		return visitNode(_contract);
+	}
+
+	bool visitNode(ASTNode& _node) override
+	{
+		_node.resetAnnotation();
+		return true;
+	}
+};
+
+}
+
+ParsedSourceCache::CachedSource const* ParsedSourceCache::lookup(
+	std::string const& _sourceUnitName,
+	h256 const& _contentHash,
+	Settings const& _settings
+)
+{
+	auto it = m_cachedSources.find(_sourceUnitName);
+	if (it == m_cachedSources.end() || it->second.first != calculateCacheKey(_contentHash, _settings))
+		return nullptr;
+
+	CachedSource const& cachedSource = it->second.second;
+	solAssert(cachedSource.ast);
+	AnnotationResetter resetter;
+	cachedSource.ast->accept(resetter);
+	return &cachedSource;
+}
+
+void ParsedSourceCache::store(
+	std::string const& _sourceUnitName,
+	h256 const& _contentHash,
+	Settings const& _settings,
+	CachedSource _source
+)
+{
+	solAssert(_source.ast);
+	solAssert(_source.idCount > 0);
+	solAssert(!Error::containsErrors(_source.diagnostics));
+	m_cachedSources.insert_or_assign(
+		_sourceUnitName,
+		std::make_pair(calculateCacheKey(_contentHash, _settings), std::move(_source))
+	);
+}
+
+h256 ParsedSourceCache::calculateCacheKey(h256 const& _contentHash, Settings const& _settings)
+{
+	bytes rawKey;
+	rawKey += _contentHash.asBytes();
+	rawKey += keccak256(_settings.evmVersion.name()).asBytes();
+	solAssert(!_settings.eofVersion.has_value() || *_settings.eofVersion > 0);
+	rawKey += FixedHash<1>(static_cast<uint8_t>(_settings.eofVersion ? *_settings.eofVersion : 0)).asBytes();
+
+	return keccak256(rawKey);
+}
@@ -0,0 +1,95 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#pragma once
+
+#include <libsolidity/ast/ASTForward.h>
+
+#include <liblangutil/EVMVersion.h>
+#include <liblangutil/Exceptions.h>
+
+#include <libsolutil/FixedHash.h>
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+
+namespace solidity::frontend
+{
+
+/// Cache of parsed source units that can be shared by consecutive runs of @a CompilerStack
+/// (e.g. in the language server or in test harnesses that compile the same sources many times).
+///
+/// Cached ASTs are not copied. The same @a SourceUnit instance is handed out on every hit,
+/// after its annotations (and other state filled in by analysis) have been cleared.
+/// This means that a cached AST can be used by only one @a CompilerStack at a time, which
+/// is already the case due to @a TypeProvider being a singleton.
+///
+/// The node IDs of a returned AST are not adjusted. The caller has to shift them
+/// (see @a shiftNodeIDs()) to the range the parser would have assigned to the source.
+class ParsedSourceCache
+{
+public:
+	/// Parser settings and context information.
+	/// Together with the content of the source, must uniquely determine the result of parsing.
+	struct Settings
+	{
+		langutil::EVMVersion evmVersion;
+		std::optional<uint8_t> eofVersion;
+	};
+
+	struct CachedSource
+	{
+		ASTPointer<SourceUnit> ast;
+		/// Number of node IDs assigned by the parser while parsing the source.
+		int64_t idCount;
+		/// Warnings and infos reported while parsing the source. Sources with errors are never cached.
+		langutil::ErrorList diagnostics;
+	};
+
+	/// @returns the cached AST of the source if its content and the settings match
+	/// those used when it was stored, or nullptr otherwise.
+	/// The annotations of the returned AST are reset.
+	CachedSource const* lookup(
+		std::string const& _sourceUnitName,
+		util::h256 const& _contentHash,
+		Settings const& _settings
+	);
+
+	/// Stores the AST of a source that was parsed without errors, replacing any earlier
+	/// entry for the same source unit name.
+	void store(
+		std::string const& _sourceUnitName,
+		util::h256 const& _contentHash,
+		Settings const& _settings,
+		CachedSource _source
+	);
+
+	size_t size() const { return m_cachedSources.size(); }
+	void clear() { m_cachedSources.clear(); }
+
+private:
+	static util::h256 calculateCacheKey(util::h256 const& _contentHash, Settings const& _settings);
+
+	/// Only the most recent version of each source unit is kept so that the size of the cache
+	/// is bounded by the number of distinct source unit names.
+	std::map<std::string, std::pair<util::h256, CachedSource>> m_cachedSources;
+};
+
+}
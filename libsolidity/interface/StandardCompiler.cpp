@@ -435,7 +435,7 @@ std::optional<Json> checkSettingsKeys(Json const& _input)
 
 std::optional<Json> checkModelCheckerSettingsKeys(Json const& _input)
 {
-	static std::set<std::string> keys{"bmcLoopIterations", "contracts", "divModNoSlacks", "engine", "extCalls", "invariants", "printQuery", "showProvedSafe", "showUnproved", "showUnsupported", "solvers", "targets", "timeout"};
+	static std::set<std::string> keys{"bmcLoopIterations", "contracts", "divModNoSlacks", "engine", "extCalls", "invariants", "printQuery", "showProvedSafe", "showUnproved", "showUnsupported", "solverWorkers", "solvers", "targets", "timeout"};
 	return checkKeys(_input, keys, "modelChecker");
 }
 
@@ -636,7 +636,7 @@ std::variant<OptimiserSettings, Json> parseOptimizerSettings(std::string_view co
 
 }
 
-std::variant<StandardCompiler::InputsAndSettings, Json> StandardCompiler::parseInput(Json const& _input)
+std::variant<StandardCompiler::InputsAndSettings, Json> StandardCompiler::parseInput(Json _input)
 {
 	InputsAndSettings ret;
 
@@ -648,7 +648,9 @@ std::variant<StandardCompiler::InputsAndSettings, Json> StandardCompiler::parseI
 
 	ret.language = _input.value<std::string>("language", "");
 
-	Json const& sources = _input.value<Json>("sources", Json());
+	// Take the sources out of the input instead of copying them (which json::value() would do),
+	// so that their contents can be moved into the result below.
+	Json sources = _input.contains("sources") ? std::move(_input["sources"]) : Json();
 
 	if (!sources.is_object() && !sources.is_null())
 		return formatFatalError(Error::Type::JSONError, "\"sources\" is not a JSON object.");
@@ -661,7 +663,7 @@ std::variant<StandardCompiler::InputsAndSettings, Json> StandardCompiler::parseI
 
 	if (ret.language == "Solidity" || ret.language == "Yul")
 	{
-		for (auto const& [sourceName, sourceValue]: sources.items())
+		for (auto&& [sourceName, sourceValue]: sources.items())
 		{
 			std::string hash;
 
@@ -673,7 +675,7 @@ std::variant<StandardCompiler::InputsAndSettings, Json> StandardCompiler::parseI
 
 			if (sourceValue.contains("content") && sourceValue["content"].is_string())
 			{
-				std::string content = sourceValue["content"].get<std::string>();
+				std::string& content = sourceValue["content"].get_ref<std::string&>();
 				if (!hash.empty() && !hashMatchesContent(hash, content))
 					ret.errors.emplace_back(formatError(
 						Error::Type::IOError,
@@ -681,7 +683,7 @@ std::variant<StandardCompiler::InputsAndSettings, Json> StandardCompiler::parseI
 						"Mismatch between content and supplied hash for \"" + sourceName + "\""
 					));
 				else
-					ret.sources[sourceName] = content;
+					ret.sources[sourceName] = std::move(content);
 			}
 			else if (sourceValue["urls"].is_array())
 			{
@@ -708,7 +710,7 @@ std::variant<StandardCompiler::InputsAndSettings, Json> StandardCompiler::parseI
 							));
 						else
 						{
-							ret.sources[sourceName] = result.responseOrErrorMessage;
+							ret.sources[sourceName] = std::move(result.responseOrErrorMessage);
 							found = true;
 							break;
 						}
@@ -740,7 +742,7 @@ std::variant<StandardCompiler::InputsAndSettings, Json> StandardCompiler::parseI
 	}
 	else if (ret.language == "EVMAssembly")
 	{
-		for (auto const& [sourceName, sourceValue]: sources.items())
+		for (auto&& [sourceName, sourceValue]: sources.items())
 		{
 			solAssert(sources.contains(sourceName));
 			if (
@@ -753,7 +755,7 @@ std::variant<StandardCompiler::InputsAndSettings, Json> StandardCompiler::parseI
 					"Invalid input source specified. Expected exactly one object, named 'assemblyJson', inside $.sources." + sourceName
 				);
 
-			ret.jsonSources[sourceName] = sourceValue["assemblyJson"];
+			ret.jsonSources[sourceName] = std::move(sourceValue["assemblyJson"]);
 		}
 		if (ret.jsonSources.size() != 1)
 			return formatFatalError(
@@ -1142,6 +1144,22 @@ std::variant<StandardCompiler::InputsAndSettings, Json> StandardCompiler::parseI
 		ret.modelCheckerSettings.solvers = solvers;
 	}
 
+	if (modelCheckerSettings.contains("solverWorkers"))
+	{
+		auto const& solverWorkers = modelCheckerSettings["solverWorkers"];
+		if (
+			!solverWorkers.is_number_unsigned() ||
+			solverWorkers.get<uint64_t>() == 0 ||
+			solverWorkers.get<uint64_t>() > ModelCheckerSettings::MaxSolverWorkers
+		)
+			return formatFatalError(
+				Error::Type::JSONError,
+				"settings.modelChecker.solverWorkers must be an integer between 1 and " +
+				std::to_string(ModelCheckerSettings::MaxSolverWorkers) + "."
+			);
+		ret.modelCheckerSettings.solverWorkers = static_cast<unsigned>(solverWorkers.get<uint64_t>());
+	}
+
 	if (modelCheckerSettings.contains("printQuery"))
 	{
 		auto const& printQuery = modelCheckerSettings["printQuery"];
@@ -1303,7 +1321,7 @@ Json StandardCompiler::importEVMAssembly(StandardCompiler::InputsAndSettings _in
 			creationJSON["linkReferences"] = formatLinkReferences(stack.object(sourceName).linkReferences);
 		if (evmCreationArtifactRequested("ethdebug"))
 			creationJSON["ethdebug"] = stack.ethdebug(sourceName);
-		evmData["bytecode"] = creationJSON;
+		evmData["bytecode"] = std::move(creationJSON);
 	}
 
 	if (isArtifactRequested(
@@ -1333,18 +1351,18 @@ Json StandardCompiler::importEVMAssembly(StandardCompiler::InputsAndSettings _in
 			deployedJSON["immutableReferences"] = formatImmutableReferences(stack.runtimeObject(sourceName).immutableReferences);
 		if (evmDeployedArtifactRequested("ethdebug"))
 			deployedJSON["ethdebug"] = stack.ethdebugRuntime(sourceName);
-		evmData["deployedBytecode"] = deployedJSON;
+		evmData["deployedBytecode"] = std::move(deployedJSON);
 	}
 
 	Json contractData;
 	if (!evmData.empty())
-		contractData["evm"] = evmData;
+		contractData["evm"] = std::move(evmData);
 
 	Json contractsOutput;
-	contractsOutput[sourceName][""] = contractData;
+	contractsOutput[sourceName][""] = std::move(contractData);
 	Json output;
-	output["contracts"] = contractsOutput;
-	return util::removeNullMembers(output);
+	output["contracts"] = std::move(contractsOutput);
+	return util::removeNullMembers(std::move(output));
 }
 
 Json StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inputsAndSettings)
@@ -1354,8 +1372,14 @@ Json StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inpu
 	CompilerStack compilerStack(m_readFile);
 
 	StringMap sourceList = std::move(_inputsAndSettings.sources);
+	std::set<std::string> const inputSourceNames = util::keys(sourceList);
 	if (_inputsAndSettings.language == "Solidity")
-		compilerStack.setSources(sourceList);
+	{
+		// The contents are moved into the compiler stack. They are only needed here for the
+		// assembly output, so they are retrieved from there if that is requested.
+		compilerStack.setSources(std::move(sourceList));
+		sourceList.clear();
+	}
 	for (auto const& smtLib2Response: _inputsAndSettings.smtLib2Responses)
 		compilerStack.addSMTLib2Response(smtLib2Response.first, smtLib2Response.second);
 	compilerStack.setViaIR(_inputsAndSettings.viaIR);
@@ -1504,7 +1528,7 @@ Json StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inpu
 			sourceResult["id"] = sourceIndex++;
 			if (isArtifactRequested(_inputsAndSettings.outputSelection, sourceName, "", "ast", wildcardMatchesExperimental))
 				sourceResult["ast"] = ASTJsonExporter(compilerStack.state(), compilerStack.sourceIndices()).toJson(compilerStack.ast(sourceName));
-			output["sources"][sourceName] = sourceResult;
+			output["sources"][sourceName] = std::move(sourceResult);
 		}
 
 	Json contractsOutput;
@@ -1545,7 +1569,12 @@ Json StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inpu
 		// EVM
 		Json evmData;
 		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "evm.assembly", wildcardMatchesExperimental))
+		{
+			if (_inputsAndSettings.language == "Solidity" && sourceList.empty())
+				for (std::string const& sourceName: inputSourceNames)
+					sourceList[sourceName] = compilerStack.charStream(sourceName).source();
 			evmData["assembly"] = compilerStack.assemblyString(contractName, sourceList);
+		}
 		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "evm.legacyAssembly", wildcardMatchesExperimental))
 			evmData["legacyAssembly"] = compilerStack.assemblyJSON(contractName);
 		if (isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "evm.methodIdentifiers", wildcardMatchesExperimental))
@@ -1580,7 +1609,7 @@ Json StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inpu
 				creationJSON["generatedSources"] = compilerStack.generatedSources(contractName, /* _runtime */ false);
 			if (evmCreationArtifactRequested("ethdebug"))
 				creationJSON["ethdebug"] = compilerStack.ethdebug(contractName);
-			evmData["bytecode"] = creationJSON;
+			evmData["bytecode"] = std::move(creationJSON);
 		}
 
 		if (compilationSuccess && isArtifactRequested(
@@ -1612,17 +1641,17 @@ Json StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inpu
 				deployedJSON["generatedSources"] = compilerStack.generatedSources(contractName, /* _runtime */ true);
 			if (evmDeployedArtifactRequested("ethdebug"))
 				deployedJSON["ethdebug"] = compilerStack.ethdebugRuntime(contractName);
-			evmData["deployedBytecode"] = deployedJSON;
+			evmData["deployedBytecode"] = std::move(deployedJSON);
 		}
 
 		if (!evmData.empty())
-			contractData["evm"] = evmData;
+			contractData["evm"] = std::move(evmData);
 
 		if (!contractData.empty())
 		{
 			if (!contractsOutput.contains(file))
 				contractsOutput[file] = Json::object();
-			contractsOutput[file][name] = contractData;
+			contractsOutput[file][name] = std::move(contractData);
 		}
 	}
 
@@ -1630,7 +1659,7 @@ Json StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inpu
 		output["ethdebug"] = compilerStack.ethdebug();
 
 	if (!contractsOutput.empty())
-		output["contracts"] = contractsOutput;
+		output["contracts"] = std::move(contractsOutput);
 
 	return output;
 }
@@ -1725,7 +1754,7 @@ Json StandardCompiler::compileYul(InputsAndSettings _inputsAndSettings)
 			Json sourceResult;
 			sourceResult["id"] = 0;
 			sourceResult["ast"] = stack.astJson();
-			output["sources"][sourceName] = sourceResult;
+			output["sources"][sourceName] = std::move(sourceResult);
 		}
 		stack.optimize();
 		std::tie(object, deployedObject) = stack.assembleWithDeployed();
@@ -1787,7 +1816,7 @@ Json StandardCompiler::compileYul(InputsAndSettings _inputsAndSettings)
 					bytecodeJSON["ethdebug"] = selectedObject.ethdebug;
 				if (isDeployed && evmArtifactRequested(kind, "immutableReferences"))
 					bytecodeJSON["immutableReferences"] = formatImmutableReferences(selectedObject.bytecode->immutableReferences);
-				output["contracts"][sourceName][contractName]["evm"][kind] = bytecodeJSON;
+				output["contracts"][sourceName][contractName]["evm"][kind] = std::move(bytecodeJSON);
 			}
 		}
 
@@ -1804,13 +1833,13 @@ Json StandardCompiler::compileYul(InputsAndSettings _inputsAndSettings)
 	return output;
 }
 
-Json StandardCompiler::compile(Json const& _input) noexcept
+Json StandardCompiler::compile(Json _input) noexcept
 {
 	YulStringRepository::reset();
 
 	try
 	{
-		auto parsed = parseInput(_input);
+		auto parsed = parseInput(std::move(_input));
 		if (std::holds_alternative<Json>(parsed))
 			return std::get<Json>(std::move(parsed));
 		InputsAndSettings settings = std::get<InputsAndSettings>(std::move(parsed));
@@ -1857,7 +1886,7 @@ std::string StandardCompiler::compile(std::string const& _input) noexcept
 	}
 
 //	std::cout << "Input: " << solidity::util::jsonPrettyPrint(input) << std::endl;
-	Json output = compile(input);
+	Json output = compile(std::move(input));
 //	std::cout << "Output: " << solidity::util::jsonPrettyPrint(output) << std::endl;
 
 	try
@@ -58,7 +58,8 @@ public:
 
 	/// Sets all input parameters according to @a _input which conforms to the standardized input
 	/// format, performs compilation and returns a standardized output.
-	Json compile(Json const& _input) noexcept;
+	/// The source contents are moved out of @a _input, so pass it as an rvalue to avoid copying them.
+	Json compile(Json _input) noexcept;
 	/// Parses input as JSON and performs the above processing steps, returning a serialized JSON
 	/// output. Parsing errors are returned as regular errors.
 	std::string compile(std::string const& _input) noexcept;
@@ -93,7 +94,8 @@ private:
 
 	/// Parses the input json (and potentially invokes the read callback) and either returns
 	/// it in condensed form or an error as a json object.
-	std::variant<InputsAndSettings, Json> parseInput(Json const& _input);
+	/// Source contents are moved out of @a _input instead of being copied.
+	std::variant<InputsAndSettings, Json> parseInput(Json _input);
 
 	std::map<std::string, Json> parseAstFromInput(StringMap const& _sources);
 	Json importEVMAssembly(InputsAndSettings _inputsAndSettings);
@@ -18,6 +18,7 @@
 #include <libsolidity/ast/AST.h>
 #include <libsolidity/ast/ASTUtils.h>
 #include <libsolidity/ast/ASTVisitor.h>
+#include <libsolidity/interface/ParsedSourceCache.h>
 #include <libsolidity/interface/ReadFile.h>
 #include <libsolidity/interface/StandardCompiler.h>
 #include <libsolidity/lsp/LanguageServer.h>
@@ -154,6 +155,8 @@ LanguageServer::LanguageServer(Transport& _transport):
 	m_fileRepository("/" /* basePath */, {} /* no search paths */),
 	m_compilerStack{m_fileRepository.reader()}
 {
+	// Most files do not change between consecutive compilations, so there is no need to parse them again.
+	m_compilerStack.setParsedSourceCache(std::make_shared<ParsedSourceCache>());
 }
 
 Json LanguageServer::toRange(SourceLocation const& _location)
@@ -189,6 +192,7 @@ void LanguageServer::changeConfiguration(Json const& _settings)
 	}
 
 	m_settingsObject = _settings;
+	m_sourcesDirty = true;
 	Json jsonIncludePaths = _settings.contains("include-paths") ? _settings["include-paths"] : Json::object();
 
 	if (!jsonIncludePaths.empty())
@@ -238,6 +242,12 @@ std::vector<boost::filesystem::path> LanguageServer::allSolidityFilesFromProject
 
 void LanguageServer::compile()
 {
+	// Requests that do not modify any source (e.g. semantic tokens, which clients request
+	// after every change) can use the result of the previous compilation.
+	// Requests for files that are not open mark the sources dirty, since such files may have changed on disk.
+	if (!m_sourcesDirty)
+		return;
+
 	// For files that are not open, we have to take changes on disk into account,
 	// so we just remove all non-open files.
 
@@ -262,11 +272,10 @@ void LanguageServer::compile()
 			oldRepository.sourceUnits().at(oldRepository.uriToSourceUnitName(fileName))
 		);
 
-	// TODO: optimize! do not recompile if nothing has changed (file(s) not flagged dirty).
-
 	m_compilerStack.reset(false);
 	m_compilerStack.setSources(m_fileRepository.sourceUnits());
 	m_compilerStack.compile(CompilerStack::State::AnalysisSuccessful);
+	m_sourcesDirty = false;
 }
 
 void LanguageServer::compileAndUpdateDiagnostics()
@@ -441,6 +450,8 @@ void LanguageServer::semanticTokensFull(MessageID _id, Json const& _args)
 	{
 		auto uri = _args["textDocument"]["uri"];
 
+		if (!m_openFiles.count(uri.get<std::string>()))
+			m_sourcesDirty = true;
 		compile();
 
 		auto const sourceName = m_fileRepository.uriToSourceUnitName(uri.get<std::string>());
@@ -496,6 +507,7 @@ void LanguageServer::handleTextDocumentDidOpen(Json const& _args)
 		std::string uri = _args["textDocument"]["uri"].get<std::string>();
 		m_openFiles.insert(uri);
 		m_fileRepository.setSourceByUri(uri, std::move(text));
+		m_sourcesDirty = true;
 		compileAndUpdateDiagnostics();
 	}
 }
@@ -543,6 +555,7 @@ void LanguageServer::handleTextDocumentDidChange(Json const& _args)
 				}
 			}
 
+		m_sourcesDirty = true;
 		compileAndUpdateDiagnostics();
 	}
 }
@@ -562,6 +575,7 @@ void LanguageServer::handleTextDocumentDidClose(Json const& _args)
 		std::string uri = _args["textDocument"]["uri"].get<std::string>();
 		m_openFiles.erase(uri);
 
+		m_sourcesDirty = true;
 		compileAndUpdateDiagnostics();
 	}
 }
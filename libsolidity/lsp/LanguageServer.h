@@ -99,7 +99,7 @@ private:
 	/// Invoked when the server user-supplied configuration changes (initiated by the client).
 	void changeConfiguration(Json const&);
 
-	/// Compile everything until after analysis phase.
+	/// Compile everything until after analysis phase, unless nothing changed since the last compilation.
 	void compile();
 
 	std::vector<boost::filesystem::path> allSolidityFilesFromProject() const;
@@ -123,6 +123,9 @@ private:
 	std::set<std::string> m_nonemptyDiagnostics;
 	FileRepository m_fileRepository;
 	FileLoadStrategy m_fileLoadStrategy = FileLoadStrategy::ProjectDirectory;
+	/// Whether the sources or the settings affecting their compilation changed since the last
+	/// compilation, i.e. whether compile() has to run the compiler again.
+	bool m_sourcesDirty = true;
 
 	frontend::CompilerStack m_compilerStack;
 
@@ -23,6 +23,7 @@
 
 #include <libsolidity/parsing/Parser.h>
 
+#include <libsolidity/ast/ASTArena.h>
 #include <libsolidity/ast/UserDefinableOperators.h>
 #include <libsolidity/interface/Version.h>
 #include <libyul/AST.h>
@@ -39,6 +40,7 @@
 
 #include <cctype>
 #include <memory>
+#include <mutex>
 #include <regex>
 #include <tuple>
 #include <vector>
@@ -76,7 +78,7 @@ public:
 		solAssert(m_location.sourceName, "");
 		if (m_location.end < 0)
 			markEndPosition();
-		return std::make_shared<NodeType>(m_parser.nextID(), m_location, std::forward<Args>(_args)...);
+		return makeInArena<NodeType>(m_parser.m_arena, m_parser.nextID(), m_location, std::forward<Args>(_args)...);
 	}
 
 	SourceLocation const& location() const noexcept { return m_location; }
@@ -92,6 +94,7 @@ ASTPointer<SourceUnit> Parser::parse(CharStream& _charStream)
 	try
 	{
 		m_recursionDepth = 0;
+		m_arena = std::make_shared<ASTArena>();
 		m_scanner = std::make_shared<Scanner>(_charStream);
 		ASTNodeFactory nodeFactory(*this);
 		m_experimentalSolidityEnabledInCurrentSourceUnit = false;
@@ -222,7 +225,7 @@ ASTPointer<StructuredDocumentation> Parser::parseStructuredDocumentation()
 		ASTNodeFactory nodeFactory{*this};
 		nodeFactory.setLocation(m_scanner->currentCommentLocation());
 		return nodeFactory.createNode<StructuredDocumentation>(
-			std::make_shared<ASTString>(m_scanner->currentCommentLiteral())
+			makeInArena<ASTString>(m_arena, m_scanner->currentCommentLiteral())
 		);
 	}
 	return nullptr;
@@ -288,7 +291,7 @@ ASTPointer<ImportDirective> Parser::parseImportDirective()
 	ASTNodeFactory nodeFactory(*this);
 	expectToken(Token::Import);
 	ASTPointer<ASTString> path;
-	ASTPointer<ASTString> unitAlias = std::make_shared<std::string>();
+	ASTPointer<ASTString> unitAlias = makeInArena<ASTString>(m_arena);
 	SourceLocation unitAliasLocation{};
 	ImportDirective::SymbolAliasList symbolAliases;
 
@@ -743,7 +746,7 @@ ASTPointer<FunctionDefinition> Parser::parseFunctionDefinition(bool _freeFunctio
 				{Token::Receive, "receive function"},
 			}.at(m_scanner->currentToken());
 			nameLocation = currentLocation();
-			name = std::make_shared<ASTString>(TokenTraits::toString(m_scanner->currentToken()));
+			name = makeInArena<ASTString>(m_arena, TokenTraits::toString(m_scanner->currentToken()));
 			std::string message{
 				"This function is named \"" + *name + "\" but is not the " + expected + " of the contract. "
 				"If you intend this to be a " + expected + ", use \"" + *name + "(...) { ... }\" without "
@@ -762,7 +765,7 @@ ASTPointer<FunctionDefinition> Parser::parseFunctionDefinition(bool _freeFunctio
 	{
 		solAssert(kind == Token::Constructor || kind == Token::Fallback || kind == Token::Receive, "");
 		advance();
-		name = std::make_shared<ASTString>();
+		name = makeInArena<ASTString>(m_arena);
 	}
 
 	FunctionHeaderParserResult header = parseFunctionHeader(false);
@@ -975,7 +978,7 @@ ASTPointer<VariableDeclaration> Parser::parseVariableDeclaration(
 	}
 
 	if (_options.allowEmptyName && m_scanner->currentToken() != Token::Identifier)
-		identifier = std::make_shared<ASTString>("");
+		identifier = makeInArena<ASTString>(m_arena, "");
 	else
 	{
 		nodeFactory.markEndPosition();
@@ -1364,13 +1367,13 @@ ASTPointer<Mapping> Parser::parseMapping()
 	}
 	else
 		fatalParserError(1005_error, "Expected elementary type name or identifier for mapping key type");
-	ASTPointer<ASTString> keyName = std::make_shared<ASTString>("");
+	ASTPointer<ASTString> keyName = makeInArena<ASTString>(m_arena, "");
 	SourceLocation keyNameLocation{};
 	if (m_scanner->currentToken() == Token::Identifier)
 		tie(keyName, keyNameLocation) = expectIdentifierWithLocation();
 	expectToken(Token::DoubleArrow);
 	ASTPointer<TypeName> valueType = parseTypeName();
-	ASTPointer<ASTString> valueName = std::make_shared<ASTString>("");
+	ASTPointer<ASTString> valueName = makeInArena<ASTString>(m_arena, "");
 	SourceLocation valueNameLocation{};
 	if (m_scanner->currentToken() == Token::Identifier)
 		tie(valueName, valueNameLocation) = expectIdentifierWithLocation();
@@ -1445,7 +1448,7 @@ ASTPointer<Statement> Parser::parseStatement(bool _allowUnchecked)
 	ASTPointer<ASTString> docString;
 	ASTPointer<Statement> statement;
 	if (m_scanner->currentCommentLiteral() != "")
-		docString = std::make_shared<ASTString>(m_scanner->currentCommentLiteral());
+		docString = makeInArena<ASTString>(m_arena, m_scanner->currentCommentLiteral());
 	switch (m_scanner->currentToken())
 	{
 	case Token::If:
@@ -1516,6 +1519,12 @@ ASTPointer<InlineAssembly> Parser::parseInlineAssembly(ASTPointer<ASTString> con
 	RecursionGuard recursionGuard(*this);
 	SourceLocation location = currentLocation();
 
+	// Source units may be parsed concurrently (see CompilerStack::parse()), but Yul names
+	// are interned in a global repository and dialects are created on demand, neither of
+	// which is thread-safe.
+	static std::mutex yulParserMutex;
+	std::lock_guard lock(yulParserMutex);
+
 	expectToken(Token::Assembly);
 	yul::Dialect const& dialect = yul::EVMDialect::strictAssemblyForEVM(m_evmVersion, m_eofVersion);
 	if (m_scanner->currentToken() == Token::StringLiteral)
@@ -1529,12 +1538,12 @@ ASTPointer<InlineAssembly> Parser::parseInlineAssembly(ASTPointer<ASTString> con
 	ASTPointer<std::vector<ASTPointer<ASTString>>> flags;
 	if (m_scanner->currentToken() == Token::LParen)
 	{
-		flags = std::make_shared<std::vector<ASTPointer<ASTString>>>();
+		flags = makeInArena<std::vector<ASTPointer<ASTString>>>(m_arena);
 		do
 		{
 			advance();
 			expectToken(Token::StringLiteral, false);
-			flags->emplace_back(std::make_shared<ASTString>(m_scanner->currentLiteral()));
+			flags->emplace_back(makeInArena<ASTString>(m_arena, m_scanner->currentLiteral()));
 			advance();
 		}
 		while (m_scanner->currentToken() == Token::Comma);
@@ -1547,7 +1556,7 @@ ASTPointer<InlineAssembly> Parser::parseInlineAssembly(ASTPointer<ASTString> con
 		solThrow(FatalError, "Failed to parse inline assembly.");
 
 	location.end = nativeLocationOf(ast->root()).end;
-	return std::make_shared<InlineAssembly>(nextID(), location, _docString, dialect, std::move(flags), ast);
+	return makeInArena<InlineAssembly>(m_arena, nextID(), location, _docString, dialect, std::move(flags), ast);
 }
 
 ASTPointer<IfStatement> Parser::parseIfStatement(ASTPointer<ASTString> const& _docString)
@@ -1592,7 +1601,7 @@ ASTPointer<TryStatement> Parser::parseTryStatement(ASTPointer<ASTString> const&
 	ASTPointer<Block> successBlock = parseBlock();
 	successClauseFactory.setEndPositionFromNode(successBlock);
 	clauses.emplace_back(successClauseFactory.createNode<TryCatchClause>(
-		std::make_shared<ASTString>(), returnsParameters, successBlock
+		makeInArena<ASTString>(m_arena), returnsParameters, successBlock
 	));
 
 	do
@@ -1611,7 +1620,7 @@ ASTPointer<TryCatchClause> Parser::parseCatchClause()
 	RecursionGuard recursionGuard(*this);
 	ASTNodeFactory nodeFactory(*this);
 	expectToken(Token::Catch);
-	ASTPointer<ASTString> errorName = std::make_shared<std::string>();
+	ASTPointer<ASTString> errorName = makeInArena<ASTString>(m_arena);
 	ASTPointer<ParameterList> errorParameters;
 	if (m_scanner->currentToken() != Token::LBrace)
 	{
@@ -1948,7 +1957,7 @@ ASTPointer<TypeDefinition> Parser::parseTypeDefinition()
 			expectToken(Token::LParen);
 
 			expression = nodeFactory.createNode<Builtin>(
-				std::make_shared<std::string>(m_scanner->currentLiteral()),
+				makeInArena<ASTString>(m_arena, m_scanner->currentLiteral()),
 				m_scanner->currentLocation()
 			);
 
@@ -2358,7 +2367,7 @@ ASTPointer<Expression> Parser::parseLiteral()
 	RecursionGuard recursionGuard(*this);
 	ASTNodeFactory nodeFactory(*this);
 	Token initialToken = m_scanner->currentToken();
-	ASTPointer<ASTString> value = std::make_shared<std::string>(m_scanner->currentLiteral());
+	ASTPointer<ASTString> value = makeInArena<ASTString>(m_arena, m_scanner->currentLiteral());
 
 	switch (initialToken)
 	{
@@ -2428,7 +2437,7 @@ ASTPointer<Expression> Parser::parsePrimaryExpression()
 		// Inside expressions "type" is the name of a special, globally-available function.
 		nodeFactory.markEndPosition();
 		advance();
-		expression = nodeFactory.createNode<Identifier>(std::make_shared<ASTString>("type"));
+		expression = nodeFactory.createNode<Identifier>(makeInArena<ASTString>(m_arena, "type"));
 		break;
 	case Token::LParen:
 	case Token::LBrack:
@@ -2778,7 +2787,7 @@ ASTPointer<Expression> Parser::expressionFromIndexAccessStructure(
 		Identifier const& identifier = dynamic_cast<Identifier const&>(*_iap.path[i]);
 		expression = nodeFactory.createNode<MemberAccess>(
 			expression,
-			std::make_shared<ASTString>(identifier.name()),
+			makeInArena<ASTString>(m_arena, identifier.name()),
 			identifier.location()
 		);
 	}
@@ -2812,7 +2821,7 @@ ASTPointer<ASTString> Parser::expectIdentifierTokenOrAddress()
 	ASTPointer<ASTString> result;
 	if (m_scanner->currentToken() == Token::Address)
 	{
-		result = std::make_shared<ASTString>("address");
+		result = makeInArena<ASTString>(m_arena, "address");
 		advance();
 	}
 	else
@@ -2825,7 +2834,7 @@ ASTPointer<ASTString> Parser::expectIdentifierTokenOrAddress()
 
 ASTPointer<ASTString> Parser::getLiteralAndAdvance()
 {
-	ASTPointer<ASTString> identifier = std::make_shared<ASTString>(m_scanner->currentLiteral());
+	ASTPointer<ASTString> identifier = makeInArena<ASTString>(m_arena, m_scanner->currentLiteral());
 	advance();
 	return identifier;
 }
@@ -2848,7 +2857,7 @@ ASTPointer<ASTString> Parser::getStdlibImportPathAndAdvance()
 	if (m_scanner->currentToken() == Token::Period)
 		advance();
 	ASTPointer<ASTString> library = expectIdentifierToken();
-	return std::make_shared<ASTString>(*std + "." + *library);
+	return makeInArena<ASTString>(m_arena, *std + "." + *library);
 }
 
 }
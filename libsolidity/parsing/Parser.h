@@ -35,6 +35,8 @@ class CharStream;
 namespace solidity::frontend
 {
 
+class ASTArena;
+
 class Parser: public langutil::ParserBase
 {
 public:
@@ -254,6 +256,8 @@ private:
 	std::optional<uint8_t> m_eofVersion;
 	/// Counter for the next AST node ID
 	int64_t m_currentNodeID = 0;
+	/// Memory for the nodes of the source unit being parsed. Kept alive by the nodes allocated from it.
+	std::shared_ptr<ASTArena> m_arena;
 	/// Flag that indicates whether experimental mode is enabled in the current source unit
 	bool m_experimentalSolidityEnabledInCurrentSourceUnit = false;
 };
@@ -505,6 +505,8 @@ void iterateReplacing(std::vector<T>& _vector, F const& _f)
 		{
 			if (!useModified)
 			{
+				// Replacements usually do not remove elements, so this avoids most reallocations.
+				modifiedVector.reserve(_vector.size() + r->size());
 				std::move(_vector.begin(), _vector.begin() + ptrdiff_t(i), back_inserter(modifiedVector));
 				useModified = true;
 			}
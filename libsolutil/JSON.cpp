@@ -57,9 +57,11 @@ void removeNullMembersHelper(Json& _json)
 	}
 }
 
-std::string escapeNewlinesAndTabsWithinStringLiterals(std::string const& _json)
+/// @returns a copy of @a _json in which raw newlines and tabs within string literals are escaped,
+/// or std::nullopt if there are none, in which case @a _json can be parsed as is.
+std::optional<std::string> escapeNewlinesAndTabsWithinStringLiterals(std::string const& _json)
 {
-	std::stringstream fixed;
+	std::optional<std::string> fixed;
 	bool inQuotes = false;
 	for (size_t i = 0; i < _json.size(); ++i)
 	{
@@ -80,26 +82,24 @@ std::string escapeNewlinesAndTabsWithinStringLiterals(std::string const& _json)
 				j--;
 			}
 			if (backslashCount % 2 == 0)
-			{
 				inQuotes = !inQuotes;
-				fixed << c;
-				continue;
-			}
 		}
 
-		if (inQuotes)
+		if (inQuotes && (c == '\n' || c == '\t'))
 		{
-			if (c == '\n')
-				fixed << "\\n";
-			else if (c == '\t')
-				fixed << "\\t";
-			else
-				fixed << c;
+			if (!fixed)
+			{
+				// Only start copying once the first character that needs escaping is found.
+				fixed.emplace();
+				fixed->reserve(_json.size() + _json.size() / 16);
+				fixed->append(_json, 0, i);
+			}
+			*fixed += (c == '\n') ? "\\n" : "\\t";
 		}
-		else
-			fixed << c;
+		else if (fixed)
+			fixed->push_back(c);
 	}
-	return fixed.str();
+	return fixed;
 }
 
 } // end anonymous namespace
@@ -142,9 +142,10 @@ bool jsonParseStrict(std::string const& _input, Json& _json, std::string* _errs
 {
 	try
 	{
+		// TODO: remove this in the next breaking release?
+		std::optional<std::string> const escapedInput = escapeNewlinesAndTabsWithinStringLiterals(_input);
 		_json = Json::parse(
-			// TODO: remove this in the next breaking release?
-			escapeNewlinesAndTabsWithinStringLiterals(_input),
+			escapedInput ? *escapedInput : _input,
 			/* callback */ nullptr,
 			/* allow exceptions */ true,
 			/* ignore_comments */true
@@ -65,6 +65,9 @@ public:
 		_other.m_value.reset();
 	}
 
+	/// Discards the stored value so that it is initialized again on next access.
+	void reset() { m_value.reset(); }
+
 	template<typename F>
 	value_type& init(F&& _fun)
 	{
@@ -0,0 +1,74 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolutil/Parallel.h>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+using namespace solidity::util;
+
+void solidity::util::parallelFor(size_t _count, size_t _workers, std::function<void(size_t)> const& _task)
+{
+#ifdef __EMSCRIPTEN__
+	_workers = 1;
+#endif
+	if (_workers <= 1 || _count <= 1)
+	{
+		for (size_t i = 0; i < _count; ++i)
+			_task(i);
+		return;
+	}
+
+	std::atomic<size_t> nextIndex = 0;
+	std::vector<std::exception_ptr> exceptions(_count);
+	auto work = [&]() {
+		for (size_t i = nextIndex++; i < _count; i = nextIndex++)
+			try
+			{
+				_task(i);
+			}
+			catch (...)
+			{
+				exceptions[i] = std::current_exception();
+			}
+	};
+
+	std::vector<std::thread> threads;
+	for (size_t i = 1; i < std::min(_workers, _count); ++i)
+		try
+		{
+			threads.emplace_back(work);
+		}
+		catch (std::system_error const&)
+		{
+			// Could not start another thread. The remaining tasks are shared among the running ones.
+			break;
+		}
+	work();
+	for (auto& thread: threads)
+		thread.join();
+
+	for (auto const& exception: exceptions)
+		if (exception)
+			std::rethrow_exception(exception);
+}
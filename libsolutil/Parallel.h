@@ -0,0 +1,39 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Helpers for running independent tasks concurrently.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace solidity::util
+{
+
+/// Calls @a _task once for every index in [0, _count), using up to @a _workers threads
+/// (the calling thread being one of them). Indices are handed out in increasing order,
+/// but tasks may finish in any order, so @a _task must only write to state owned by its index.
+/// Returns once all tasks have finished. If tasks throw, the exception of the lowest
+/// failing index is rethrown on the calling thread.
+/// With at most one worker, or on platforms without thread support, everything runs
+/// sequentially on the calling thread.
+void parallelFor(size_t _count, size_t _workers, std::function<void(size_t)> const& _task);
+
+}
@@ -0,0 +1,98 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Map from Yul names to values that is stored in a vector indexed by the IDs of the names.
+ */
+
+#pragma once
+
+#include <libyul/YulName.h>
+
+#include <algorithm>
+#include <map>
+#include <vector>
+
+namespace solidity::yul
+{
+
+/**
+ * Map from Yul names to values stored in a vector indexed by the IDs of the names (see @a YulString::id()).
+ * Lookups and updates do not compare names and do not allocate, which makes it suitable for
+ * facts about variables that are queried very often during a single optimiser step, such as
+ * reference counts.
+ *
+ * Names that were never assigned a value map to a value-initialized @a T, as with @a std::map::operator[].
+ * The storage covers the range between the smallest and the largest ID that was stored.
+ * The string repository is shared by all Yul code of a compilation and is not reset
+ * between contracts or optimiser steps, so even for the names of a single AST this range can be as large as the
+ * number of strings created so far (e.g. when a name created early, such as a builtin, is stored
+ * together with one created by the optimiser). Its size is linear in that number.
+ *
+ * The map cannot be iterated, because the order of the IDs is not deterministic.
+ */
+template <typename T>
+class DenseYulNameMap
+{
+public:
+	DenseYulNameMap() = default;
+	explicit DenseYulNameMap(std::map<YulName, T> const& _values)
+	{
+		if (_values.empty())
+			return;
+		auto [minName, maxName] = std::minmax_element(
+			_values.begin(),
+			_values.end(),
+			[](auto const& _a, auto const& _b) { return _a.first.id() < _b.first.id(); }
+		);
+		m_firstID = minName->first.id();
+		m_values.resize(maxName->first.id() - m_firstID + 1);
+		for (auto const& [name, value]: _values)
+			m_values[name.id() - m_firstID] = value;
+	}
+
+	/// @returns the value stored for @a _name or a value-initialized one if there is none.
+	T operator()(YulName _name) const
+	{
+		size_t id = _name.id();
+		if (id < m_firstID || id - m_firstID >= m_values.size())
+			return T{};
+		return m_values[id - m_firstID];
+	}
+
+	/// @returns a reference to the value stored for @a _name, inserting a value-initialized one if there is none.
+	T& operator[](YulName _name)
+	{
+		size_t id = _name.id();
+		if (m_values.empty())
+			m_firstID = id;
+		else if (id < m_firstID)
+		{
+			m_values.insert(m_values.begin(), m_firstID - id, T{});
+			m_firstID = id;
+		}
+		if (id - m_firstID >= m_values.size())
+			m_values.resize(id - m_firstID + 1);
+		return m_values[id - m_firstID];
+	}
+
+private:
+	size_t m_firstID = 0;
+	std::vector<T> m_values;
+};
+
+}
@@ -157,6 +157,10 @@ public:
 	}
 
 	uint64_t hash() const { return m_handle.hash; }
+	/// @returns the ID of the string in the repository. IDs are consecutive integers
+	/// and can be used to index flat containers (see @a DenseYulNameMap). They depend on the order in which
+	/// strings were created, so they must not be used to determine any order that affects the output.
+	size_t id() const { return m_handle.id; }
 
 private:
 	/// Handle of the string. Assumes that the empty string has ID zero.
@@ -0,0 +1,67 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libyul/optimiser/AnalysisCache.h>
+
+#include <libyul/optimiser/CallGraphGenerator.h>
+#include <libyul/optimiser/OptimiserStep.h>
+#include <libyul/optimiser/Semantics.h>
+#include <libyul/ControlFlowSideEffectsCollector.h>
+
+using namespace solidity;
+using namespace solidity::yul;
+
+std::map<FunctionHandle, SideEffects> AnalysisCache::functionSideEffects(
+	OptimiserStepContext const& _context,
+	Block const& _ast
+)
+{
+	auto compute = [&]() {
+		return SideEffectsPropagator::sideEffects(_context.dialect, CallGraphGenerator::callGraph(_ast));
+	};
+
+	if (!_context.analysisCache)
+		return compute();
+	std::optional<std::map<FunctionHandle, SideEffects>>& cached = _context.analysisCache->m_functionSideEffects;
+	if (!cached)
+		cached = compute();
+	return *cached;
+}
+
+std::map<YulName, ControlFlowSideEffects> AnalysisCache::controlFlowSideEffects(
+	OptimiserStepContext const& _context,
+	Block const& _ast
+)
+{
+	auto compute = [&]() {
+		return ControlFlowSideEffectsCollector{_context.dialect, _ast}.functionSideEffectsNamed();
+	};
+
+	if (!_context.analysisCache)
+		return compute();
+	std::optional<std::map<YulName, ControlFlowSideEffects>>& cached = _context.analysisCache->m_controlFlowSideEffects;
+	if (!cached)
+		cached = compute();
+	return *cached;
+}
+
+void AnalysisCache::invalidate()
+{
+	m_functionSideEffects.reset();
+	m_controlFlowSideEffects.reset();
+}
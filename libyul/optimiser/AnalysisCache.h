@@ -0,0 +1,72 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Cache for analyses of the whole AST that are shared by consecutive optimiser steps.
+ */
+
+#pragma once
+
+#include <libyul/ASTForward.h>
+#include <libyul/Builtins.h>
+#include <libyul/ControlFlowSideEffects.h>
+#include <libyul/SideEffects.h>
+#include <libyul/YulName.h>
+
+#include <map>
+#include <optional>
+
+namespace solidity::yul
+{
+
+struct OptimiserStepContext;
+
+/**
+ * Stores the results of analyses of the whole AST so that optimiser steps running one after
+ * another on the same AST do not have to recompute them.
+ *
+ * The cache does not detect changes to the AST on its own. It is owned by @a OptimiserSuite,
+ * which invalidates it after every step that does not declare that it preserves the
+ * analyses (see @a OptimiserStep::preservesAnalyses()).
+ *
+ * Steps access it through the static functions, which fall back to computing
+ * the analysis from scratch if the context does not provide a cache.
+ */
+class AnalysisCache
+{
+public:
+	/// @returns the side effects of all functions defined in @a _ast as computed by
+	/// @a SideEffectsPropagator from the call graph of @a _ast.
+	static std::map<FunctionHandle, SideEffects> functionSideEffects(
+		OptimiserStepContext const& _context,
+		Block const& _ast
+	);
+	/// @returns the control flow side effects of all functions defined in @a _ast as computed
+	/// by @a ControlFlowSideEffectsCollector.
+	static std::map<YulName, ControlFlowSideEffects> controlFlowSideEffects(
+		OptimiserStepContext const& _context,
+		Block const& _ast
+	);
+
+	void invalidate();
+
+private:
+	std::optional<std::map<FunctionHandle, SideEffects>> m_functionSideEffects;
+	std::optional<std::map<YulName, ControlFlowSideEffects>> m_controlFlowSideEffects;
+};
+
+}
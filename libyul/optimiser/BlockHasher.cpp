@@ -223,6 +223,16 @@ uint64_t ExpressionHasher::run(Expression const& _e)
 	return expressionHasher.m_hash;
 }
 
+uint64_t ExpressionHasher::functionCallHash(FunctionCall const& _funCall, std::vector<uint64_t> const& _argumentHashes)
+{
+	yulAssert(_funCall.arguments.size() == _argumentHashes.size(), "");
+	ExpressionHasher expressionHasher;
+	expressionHasher.hashFunctionCall(_funCall);
+	for (uint64_t argumentHash: _argumentHashes)
+		expressionHasher.hash64(argumentHash);
+	return expressionHasher.m_hash;
+}
+
 void ExpressionHasher::operator()(Literal const& _literal)
 {
 	hashLiteral(_literal);
@@ -236,6 +246,10 @@ void ExpressionHasher::operator()(Identifier const& _identifier)
 
 void ExpressionHasher::operator()(FunctionCall const& _funCall)
 {
-	hashFunctionCall(_funCall);
-	ASTWalker::operator()(_funCall);
+	// The arguments are hashed separately, so that the hash of a call can also be combined
+	// from the hashes of its arguments (see functionCallHash).
+	std::vector<uint64_t> argumentHashes;
+	for (Expression const& argument: _funCall.arguments)
+		argumentHashes.emplace_back(run(argument));
+	m_hash = functionCallHash(_funCall, argumentHashes);
 }
@@ -24,6 +24,8 @@
 #include <libyul/ASTForward.h>
 #include <libyul/YulName.h>
 
+#include <vector>
+
 namespace solidity::yul
 {
 
@@ -132,6 +134,9 @@ public:
 	/// Computes a hash of an expression that (in contrast to the behaviour of the class)
 	/// distinguishes (up to hash collisions) variables with different names.
 	static uint64_t run(Expression const& _e);
+	/// @returns the hash @a run computes for @a _funCall, given the hashes of its arguments.
+	/// Allows hashing nested expressions bottom-up without visiting any of them more than once.
+	static uint64_t functionCallHash(FunctionCall const& _funCall, std::vector<uint64_t> const& _argumentHashes);
 
 	using ASTWalker::operator();
 
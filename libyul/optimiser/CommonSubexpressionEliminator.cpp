@@ -23,7 +23,7 @@
 
 #include <libyul/optimiser/SyntacticalEquality.h>
 #include <libyul/optimiser/BlockHasher.h>
-#include <libyul/optimiser/CallGraphGenerator.h>
+#include <libyul/optimiser/AnalysisCache.h>
 #include <libyul/optimiser/Semantics.h>
 #include <libyul/SideEffects.h>
 #include <libyul/Exceptions.h>
@@ -39,7 +39,7 @@ void CommonSubexpressionEliminator::run(OptimiserStepContext& _context, Block& _
 {
 	CommonSubexpressionEliminator cse{
 		_context.dialect,
-		SideEffectsPropagator::sideEffects(_context.dialect, CallGraphGenerator::callGraph(_ast))
+		AnalysisCache::functionSideEffects(_context, _ast)
 	};
 	cse(_ast);
 }
@@ -56,6 +56,7 @@ void CommonSubexpressionEliminator::operator()(FunctionDefinition& _fun)
 {
 	ScopedSaveAndRestore returnVariables(m_returnVariables, {});
 	ScopedSaveAndRestore replacementCandidates(m_replacementCandidates, {});
+	ScopedSaveAndRestore expressionHashes(m_expressionHashes, {});
 
 	for (auto const& v: _fun.returnVariables)
 		m_returnVariables.insert(v.name);
@@ -93,6 +94,17 @@ void CommonSubexpressionEliminator::visit(Expression& _e)
 	if (descend)
 		DataFlowAnalyzer::visit(_e);
 
+	// The arguments have been visited already, so the hash of a call is combined from theirs
+	// instead of hashing the whole subtree again.
+	uint64_t hash = 0;
+	if (FunctionCall const* funCall = std::get_if<FunctionCall>(&_e))
+	{
+		std::vector<uint64_t> argumentHashes;
+		for (Expression const& argument: funCall->arguments)
+			argumentHashes.emplace_back(takeHash(argument));
+		hash = ExpressionHasher::functionCallHash(*funCall, argumentHashes);
+	}
+
 	if (Identifier const* identifier = std::get_if<Identifier>(&_e))
 	{
 		YulName identifierName = identifier->name;
@@ -104,7 +116,10 @@ void CommonSubexpressionEliminator::visit(Expression& _e)
 					_e = Identifier{debugDataOf(_e), value->name};
 		}
 	}
-	else if (auto const* candidates = util::valueOrNullptr(m_replacementCandidates, _e))
+	else if (auto const* candidates = util::valueOrNullptr(
+		m_replacementCandidates,
+		HashedExpression{_e, std::holds_alternative<FunctionCall>(_e) ? hash : ExpressionHasher::run(_e)}
+	))
 		for (auto const& variable: *candidates)
 			if (AssignedValue const* value = variableValue(variable))
 			{
@@ -124,11 +139,22 @@ void CommonSubexpressionEliminator::visit(Expression& _e)
 					break;
 				}
 			}
+
+	if (!std::holds_alternative<FunctionCall>(_e))
+		hash = ExpressionHasher::run(_e);
+	m_expressionHashes[&_e] = hash;
 }
 
 void CommonSubexpressionEliminator::assignValue(YulName _variable, Expression const* _value)
 {
 	if (_value)
-		m_replacementCandidates[*_value].insert(_variable);
+		m_replacementCandidates[HashedExpression{*_value, takeHash(*_value)}].insert(_variable);
 	DataFlowAnalyzer::assignValue(_variable, _value);
 }
+
+uint64_t CommonSubexpressionEliminator::takeHash(Expression const& _expression)
+{
+	if (auto node = m_expressionHashes.extract(&_expression))
+		return node.mapped();
+	return ExpressionHasher::run(_expression);
+}
@@ -62,12 +62,36 @@ protected:
 
 	void assignValue(YulName _variable, Expression const* _value) override;
 private:
+	/// Expression together with its hash as computed by ExpressionHasher.
+	struct HashedExpression
+	{
+		std::reference_wrapper<Expression const> expression;
+		uint64_t hash;
+	};
+	struct HashedExpressionHash
+	{
+		size_t operator()(HashedExpression const& _expression) const { return _expression.hash; }
+	};
+	struct HashedExpressionEqual
+	{
+		bool operator()(HashedExpression const& _lhs, HashedExpression const& _rhs) const
+		{
+			return _lhs.hash == _rhs.hash && SyntacticallyEqualExpression{}(_lhs.expression, _rhs.expression);
+		}
+	};
+
+	/// @returns the hash of @a _expression, which is taken from m_expressionHashes
+	/// (and removed from there) if it has been visited.
+	uint64_t takeHash(Expression const& _expression);
+
 	std::set<YulName> m_returnVariables;
+	/// Hashes of visited expressions whose parents have not been visited yet.
+	std::unordered_map<Expression const*, uint64_t> m_expressionHashes;
 	std::unordered_map<
-		std::reference_wrapper<Expression const>,
+		HashedExpression,
 		std::set<YulName>,
-		ExpressionHash,
-		SyntacticallyEqualExpression
+		HashedExpressionHash,
+		HashedExpressionEqual
 	> m_replacementCandidates;
 };
 
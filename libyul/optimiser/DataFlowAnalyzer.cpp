@@ -33,6 +33,7 @@
 
 #include <libsolutil/CommonData.h>
 
+#include <utility>
 #include <variant>
 
 #include <range/v3/view/reverse.hpp>
@@ -41,6 +42,64 @@ using namespace solidity;
 using namespace solidity::util;
 using namespace solidity::yul;
 
+namespace
+{
+
+/**
+ * Side effects collector that records the side effects of every block and for loop condition
+ * it visits and re-uses recorded side effects instead of visiting the same subtree again.
+ */
+class SubtreeSideEffectsCollector: public SideEffectsCollector
+{
+public:
+	SubtreeSideEffectsCollector(
+		Dialect const& _dialect,
+		std::map<FunctionHandle, SideEffects> const& _functionSideEffects,
+		std::unordered_map<Block const*, SideEffects>& _blockSideEffects,
+		std::unordered_map<Expression const*, SideEffects>& _loopConditionSideEffects
+	):
+		SideEffectsCollector(_dialect, &_functionSideEffects),
+		m_blockSideEffects(_blockSideEffects),
+		m_loopConditionSideEffects(_loopConditionSideEffects)
+	{}
+
+	using SideEffectsCollector::operator();
+
+	void operator()(Block const& _block) override
+	{
+		collect(m_blockSideEffects, _block, [&]() { SideEffectsCollector::operator()(_block); });
+	}
+
+	void operator()(ForLoop const& _for) override
+	{
+		(*this)(_for.pre);
+		collect(m_loopConditionSideEffects, *_for.condition, [&]() { visit(*_for.condition); });
+		(*this)(_for.body);
+		(*this)(_for.post);
+	}
+
+private:
+	/// Adds the side effects of @a _node, visiting it using @a _visit only if they were not recorded yet.
+	template <typename Node, typename Visit>
+	void collect(std::unordered_map<Node const*, SideEffects>& _recorded, Node const& _node, Visit&& _visit)
+	{
+		auto it = _recorded.find(&_node);
+		if (it == _recorded.end())
+		{
+			SideEffects outerSideEffects = std::exchange(m_sideEffects, SideEffects{});
+			_visit();
+			it = _recorded.emplace(&_node, m_sideEffects).first;
+			m_sideEffects = outerSideEffects;
+		}
+		m_sideEffects += it->second;
+	}
+
+	std::unordered_map<Block const*, SideEffects>& m_blockSideEffects;
+	std::unordered_map<Expression const*, SideEffects>& m_loopConditionSideEffects;
+};
+
+}
+
 DataFlowAnalyzer::DataFlowAnalyzer(
 	Dialect const& _dialect,
 	MemoryAndStorage _analyzeStores,
@@ -67,23 +126,24 @@ void DataFlowAnalyzer::operator()(ExpressionStatement& _statement)
 		if (auto vars = isSimpleStore(StoreLoadLocation::Storage, _statement))
 		{
 			ASTModifier::operator()(_statement);
-			std::erase_if(m_state.environment.storage, mapTuple([&](auto&& key, auto&& value) {
+			eraseFromEnvironment(&Environment::storage, mapTuple([&](auto&& key, auto&& value) {
 				return
 					!m_knowledgeBase.knownToBeDifferent(vars->first, key) &&
 					vars->second != value;
 			}));
-			m_state.environment.storage[vars->first] = vars->second;
+			modifiableEnvironment().storage[vars->first] = vars->second;
 			return;
 		}
 		else if (auto vars = isSimpleStore(StoreLoadLocation::Memory, _statement))
 		{
 			ASTModifier::operator()(_statement);
-			std::erase_if(m_state.environment.memory, mapTuple([&](auto&& key, auto&& /* value */) {
+			eraseFromEnvironment(&Environment::memory, mapTuple([&](auto&& key, auto&& /* value */) {
 				return !m_knowledgeBase.knownToBeDifferentByAtLeast32(vars->first, key);
 			}));
+			Environment& environment = modifiableEnvironment();
 			// TODO erase keccak knowledge, but in a more clever way
-			m_state.environment.keccak = {};
-			m_state.environment.memory[vars->first] = vars->second;
+			environment.keccak = {};
+			environment.memory[vars->first] = vars->second;
 			return;
 		}
 	}
@@ -121,10 +181,10 @@ void DataFlowAnalyzer::operator()(VariableDeclaration& _varDecl)
 void DataFlowAnalyzer::operator()(If& _if)
 {
 	clearKnowledgeIfInvalidated(*_if.condition);
-	Environment preEnvironment = m_state.environment;
+	std::shared_ptr<Environment const> preEnvironment = m_state.environment;
 
 	ASTModifier::operator()(_if);
-	joinKnowledge(preEnvironment);
+	joinKnowledge(*preEnvironment);
 
 	clearValues(assignedVariableNames(_if.body));
 }
@@ -136,9 +196,9 @@ void DataFlowAnalyzer::operator()(Switch& _switch)
 	std::set<YulName> assignedVariables;
 	for (auto& _case: _switch.cases)
 	{
-		Environment preEnvironment = m_state.environment;
+		std::shared_ptr<Environment const> preEnvironment = m_state.environment;
 		(*this)(_case.body);
-		joinKnowledge(preEnvironment);
+		joinKnowledge(*preEnvironment);
 
 		std::set<YulName> variables = assignedVariableNames(_case.body);
 		assignedVariables += variables;
@@ -219,7 +279,7 @@ void DataFlowAnalyzer::operator()(Block& _block)
 
 std::optional<YulName> DataFlowAnalyzer::storageValue(YulName _key) const
 {
-	if (YulName const* value = valueOrNullptr(m_state.environment.storage, _key))
+	if (YulName const* value = valueOrNullptr(m_state.environment->storage, _key))
 		return *value;
 	else
 		return std::nullopt;
@@ -227,7 +287,7 @@ std::optional<YulName> DataFlowAnalyzer::storageValue(YulName _key) const
 
 std::optional<YulName> DataFlowAnalyzer::memoryValue(YulName _key) const
 {
-	if (YulName const* value = valueOrNullptr(m_state.environment.memory, _key))
+	if (YulName const* value = valueOrNullptr(m_state.environment->memory, _key))
 		return *value;
 	else
 		return std::nullopt;
@@ -235,7 +295,7 @@ std::optional<YulName> DataFlowAnalyzer::memoryValue(YulName _key) const
 
 std::optional<YulName> DataFlowAnalyzer::keccakValue(YulName _start, YulName _length) const
 {
-	if (YulName const* value = valueOrNullptr(m_state.environment.keccak, std::make_pair(_start, _length)))
+	if (YulName const* value = valueOrNullptr(m_state.environment->keccak, std::make_pair(_start, _length)))
 		return *value;
 	else
 		return std::nullopt;
@@ -269,17 +329,16 @@ void DataFlowAnalyzer::handleAssignment(std::set<YulName> const& _variables, Exp
 		m_state.sortedReferences[name] = referencedVariablesSorted;
 		if (!_isDeclaration)
 		{
-			// assignment to slot denoted by "name"
-			m_state.environment.storage.erase(name);
-			// assignment to slot contents denoted by "name"
-			std::erase_if(m_state.environment.storage, mapTuple([&name](auto&& /* key */, auto&& value) { return value == name; }));
-			// assignment to slot denoted by "name"
-			m_state.environment.memory.erase(name);
-			// assignment to slot contents denoted by "name"
-			std::erase_if(m_state.environment.keccak, [&name](auto&& _item) {
+			// assignment to slot denoted by "name" or to slot contents denoted by "name"
+			eraseFromEnvironment(&Environment::storage, mapTuple([&name](auto&& key, auto&& value) {
+				return key == name || value == name;
+			}));
+			eraseFromEnvironment(&Environment::keccak, [&name](auto&& _item) {
 				return _item.first.first == name || _item.first.second == name || _item.second == name;
 			});
-			std::erase_if(m_state.environment.memory, mapTuple([&name](auto&& /* key */, auto&& value) { return value == name; }));
+			eraseFromEnvironment(&Environment::memory, mapTuple([&name](auto&& key, auto&& value) {
+				return key == name || value == name;
+			}));
 		}
 	}
 
@@ -292,11 +351,11 @@ void DataFlowAnalyzer::handleAssignment(std::set<YulName> const& _variables, Exp
 			// On the other hand, if we knew the value in the slot
 			// already, then the sload() / mload() would have been replaced by a variable anyway.
 			if (auto key = isSimpleLoad(StoreLoadLocation::Memory, *_value))
-				m_state.environment.memory[*key] = variable;
+				modifiableEnvironment().memory[*key] = variable;
 			else if (auto key = isSimpleLoad(StoreLoadLocation::Storage, *_value))
-				m_state.environment.storage[*key] = variable;
+				modifiableEnvironment().storage[*key] = variable;
 			else if (auto arguments = isKeccak(*_value))
-				m_state.environment.keccak[*arguments] = variable;
+				modifiableEnvironment().keccak[*arguments] = variable;
 		}
 	}
 }
@@ -337,9 +396,9 @@ void DataFlowAnalyzer::clearValues(std::set<YulName> const& _variablesToClear)
 	auto eraseCondition = mapTuple([&_variablesToClear](auto&& key, auto&& value) {
 		return _variablesToClear.count(key) || _variablesToClear.count(value);
 	});
-	std::erase_if(m_state.environment.storage, eraseCondition);
-	std::erase_if(m_state.environment.memory, eraseCondition);
-	std::erase_if(m_state.environment.keccak, [&_variablesToClear](auto&& _item) {
+	eraseFromEnvironment(&Environment::storage, eraseCondition);
+	eraseFromEnvironment(&Environment::memory, eraseCondition);
+	eraseFromEnvironment(&Environment::keccak, [&_variablesToClear](auto&& _item) {
 		return
 			_variablesToClear.count(_item.first.first) ||
 			_variablesToClear.count(_item.first.second) ||
@@ -372,27 +431,33 @@ void DataFlowAnalyzer::clearKnowledgeIfInvalidated(Block const& _block)
 {
 	if (!m_analyzeStores)
 		return;
-	SideEffectsCollector sideEffects(m_dialect, _block, &m_functionSideEffects);
-	if (sideEffects.invalidatesStorage())
-		m_state.environment.storage.clear();
-	if (sideEffects.invalidatesMemory())
-	{
-		m_state.environment.memory.clear();
-		m_state.environment.keccak.clear();
-	}
+	SubtreeSideEffectsCollector sideEffects(m_dialect, m_functionSideEffects, m_blockSideEffects, m_loopConditionSideEffects);
+	sideEffects(_block);
+	clearKnowledgeIfInvalidated(sideEffects.sideEffects());
 }
 
 void DataFlowAnalyzer::clearKnowledgeIfInvalidated(Expression const& _expr)
 {
 	if (!m_analyzeStores)
 		return;
-	SideEffectsCollector sideEffects(m_dialect, _expr, &m_functionSideEffects);
-	if (sideEffects.invalidatesStorage())
-		m_state.environment.storage.clear();
-	if (sideEffects.invalidatesMemory())
+	if (SideEffects const* sideEffects = valueOrNullptr(m_loopConditionSideEffects, &_expr))
+		clearKnowledgeIfInvalidated(*sideEffects);
+	else
+		clearKnowledgeIfInvalidated(SideEffectsCollector(m_dialect, _expr, &m_functionSideEffects).sideEffects());
+}
+
+void DataFlowAnalyzer::clearKnowledgeIfInvalidated(SideEffects const& _sideEffects)
+{
+	if (_sideEffects.storage == SideEffects::Write && !m_state.environment->storage.empty())
+		modifiableEnvironment().storage.clear();
+	if (
+		_sideEffects.memory == SideEffects::Write &&
+		(!m_state.environment->memory.empty() || !m_state.environment->keccak.empty())
+	)
 	{
-		m_state.environment.memory.clear();
-		m_state.environment.keccak.clear();
+		Environment& environment = modifiableEnvironment();
+		environment.memory.clear();
+		environment.keccak.clear();
 	}
 }
 
@@ -464,25 +529,28 @@ void DataFlowAnalyzer::joinKnowledge(Environment const& _olderEnvironment)
 {
 	if (!m_analyzeStores)
 		return;
-	joinKnowledgeHelper(m_state.environment.storage, _olderEnvironment.storage);
-	joinKnowledgeHelper(m_state.environment.memory, _olderEnvironment.memory);
-	std::erase_if(m_state.environment.keccak, mapTuple([&_olderEnvironment](auto&& key, auto&& currentValue) {
-		YulName const* oldValue = valueOrNullptr(_olderEnvironment.keccak, key);
-		return !oldValue || *oldValue != currentValue;
-	}));
+	// Nothing changed since the older environment was saved.
+	if (m_state.environment.get() == &_olderEnvironment)
+		return;
+
+	// We clear if the key does not exist in the older map or if the value is different.
+	// This also works for memory because _olderEnvironment.memory is an "older version"
+	// of the current memory environment and thus any overlapping write would have cleared the keys
+	// that are not known to be different inside the current one already.
+	auto changedSince = [](auto const& _older) {
+		return mapTuple([&_older](auto&& key, auto&& currentValue) {
+			auto const* oldValue = valueOrNullptr(_older, key);
+			return !oldValue || *oldValue != currentValue;
+		});
+	};
+	eraseFromEnvironment(&Environment::storage, changedSince(_olderEnvironment.storage));
+	eraseFromEnvironment(&Environment::memory, changedSince(_olderEnvironment.memory));
+	eraseFromEnvironment(&Environment::keccak, changedSince(_olderEnvironment.keccak));
 }
 
-void DataFlowAnalyzer::joinKnowledgeHelper(
-	std::unordered_map<YulName, YulName>& _this,
-	std::unordered_map<YulName, YulName> const& _older
-)
+DataFlowAnalyzer::Environment& DataFlowAnalyzer::modifiableEnvironment()
 {
-	// We clear if the key does not exist in the older map or if the value is different.
-	// This also works for memory because _older is an "older version"
-	// of m_state.environment.memory and thus any overlapping write would have cleared the keys
-	// that are not known to be different inside m_state.environment.memory already.
-	std::erase_if(_this, mapTuple([&_older](auto&& key, auto&& currentValue){
-		YulName const* oldValue = valueOrNullptr(_older, key);
-		return !oldValue || *oldValue != currentValue;
-	}));
+	if (m_state.environment.use_count() > 1)
+		m_state.environment = std::make_shared<Environment>(*m_state.environment);
+	return *m_state.environment;
 }
@@ -32,7 +32,9 @@
 #include <libsolutil/Numeric.h>
 #include <libsolutil/Common.h>
 
+#include <algorithm>
 #include <map>
+#include <memory>
 #include <set>
 
 namespace solidity::yul
@@ -127,6 +129,8 @@ protected:
 	virtual void assignValue(YulName _variable, Expression const* _value);
 
 	/// Clears knowledge about storage or memory if they may be modified inside the block.
+	/// The side effects of the block and of all blocks and loop conditions nested in it
+	/// are recorded and re-used by later calls.
 	void clearKnowledgeIfInvalidated(Block const& _block);
 
 	/// Clears knowledge about storage or memory if they may be modified inside the expression.
@@ -183,7 +187,9 @@ private:
 		/// The mapped vectors _must always_ be sorted
 		std::unordered_map<YulName, std::vector<YulName>> sortedReferences;
 
-		Environment environment;
+		/// Shared with the environments saved when entering branches and
+		/// only copied when it is modified while shared.
+		std::shared_ptr<Environment> environment = std::make_shared<Environment>();
 	};
 
 	/// Joins knowledge about storage and memory with an older point in the control-flow.
@@ -192,13 +198,29 @@ private:
 	/// Does nothing if memory and storage analysis is disabled / ignored.
 	void joinKnowledge(Environment const& _olderEnvironment);
 
-	static void joinKnowledgeHelper(
-		std::unordered_map<YulName, YulName>& _thisData,
-		std::unordered_map<YulName, YulName> const& _olderData
-	);
+	void clearKnowledgeIfInvalidated(SideEffects const& _sideEffects);
+
+	/// @returns the current environment for modification, copying it first if it is shared.
+	Environment& modifiableEnvironment();
+
+	/// Erases the entries satisfying @a _predicate from the map @a _map of the current environment.
+	/// Does not copy a shared environment unless there is something to erase.
+	template <typename Map, typename Predicate>
+	void eraseFromEnvironment(Map Environment::* _map, Predicate _predicate)
+	{
+		Map const& entries = (*m_state.environment).*_map;
+		if (m_state.environment.use_count() == 1 || std::any_of(entries.begin(), entries.end(), _predicate))
+			std::erase_if(modifiableEnvironment().*_map, _predicate);
+	}
 
 	State m_state;
 
+	/// Side effects of blocks and for loop conditions determined by clearKnowledgeIfInvalidated().
+	/// The nodes are modified during the walk, but only in ways that do not change whether they
+	/// write to storage or memory (e.g. by replacing loads by variables), so they remain valid.
+	std::unordered_map<Block const*, SideEffects> m_blockSideEffects;
+	std::unordered_map<Expression const*, SideEffects> m_loopConditionSideEffects;
+
 protected:
 	KnowledgeBase m_knowledgeBase;
 
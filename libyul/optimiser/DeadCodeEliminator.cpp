@@ -22,7 +22,7 @@
 #include <libyul/optimiser/DeadCodeEliminator.h>
 #include <libyul/optimiser/Semantics.h>
 #include <libyul/optimiser/OptimiserStep.h>
-#include <libyul/ControlFlowSideEffectsCollector.h>
+#include <libyul/optimiser/AnalysisCache.h>
 #include <libyul/AST.h>
 
 #include <libevmasm/SemanticInformation.h>
@@ -36,10 +36,9 @@ using namespace solidity::yul;
 
 void DeadCodeEliminator::run(OptimiserStepContext& _context, Block& _ast)
 {
-	ControlFlowSideEffectsCollector sideEffects(_context.dialect, _ast);
 	DeadCodeEliminator{
 		_context.dialect,
-		sideEffects.functionSideEffectsNamed()
+		AnalysisCache::controlFlowSideEffects(_context, _ast)
 	}(_ast);
 }
 
@@ -85,7 +85,7 @@ void ExpressionJoiner::visit(Expression& _e)
 
 ExpressionJoiner::ExpressionJoiner(Block& _ast)
 {
-	m_references = VariableReferencesCounter::countReferences(_ast);
+	m_references = DenseYulNameMap<size_t>(VariableReferencesCounter::countReferences(_ast));
 }
 
 void ExpressionJoiner::handleArguments(std::vector<Expression>& _arguments)
@@ -144,5 +144,5 @@ bool ExpressionJoiner::isLatestStatementVarDeclJoinable(Identifier const& _ident
 		return false;
 	assertThrow(varDecl.variables.size() == 1, OptimizerException, "");
 	assertThrow(varDecl.value, OptimizerException, "");
-	return varDecl.variables.at(0).name == _identifier.name && m_references[_identifier.name] == 1;
+	return varDecl.variables.at(0).name == _identifier.name && m_references(_identifier.name) == 1;
 }
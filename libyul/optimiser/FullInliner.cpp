@@ -46,12 +46,35 @@ using namespace solidity::yul;
 
 void FullInliner::run(OptimiserStepContext& _context, Block& _ast)
 {
-	FullInliner inliner{_ast, _context.dispenser, _context.dialect};
+	FullInliner inliner{
+		_ast,
+		_context.dispenser,
+		_context.dialect,
+		_context.expectedExecutionsPerDeployment,
+		_context.maxCodeSize
+	};
 	inliner.run(Pass::InlineTiny);
 	inliner.run(Pass::InlineRest);
 }
 
-FullInliner::FullInliner(Block& _ast, NameDispenser& _dispenser, Dialect const& _dialect):
+size_t FullInliner::maxCodeSize(size_t _codeSize, std::optional<size_t> _expectedExecutionsPerDeployment)
+{
+	// Creation code is executed only once, so inlining may at most double its size.
+	// Runtime code that is executed often enough may grow more, since the call overhead
+	// saved per execution outweighs the cost of deploying the larger code.
+	size_t growthFactor = 1;
+	if (_expectedExecutionsPerDeployment)
+		growthFactor = *_expectedExecutionsPerDeployment < 1000 ? 2 : 4;
+	return _codeSize + std::max(MinimumGrowthBudget, growthFactor * _codeSize);
+}
+
+FullInliner::FullInliner(
+	Block& _ast,
+	NameDispenser& _dispenser,
+	Dialect const& _dialect,
+	std::optional<size_t> _expectedExecutionsPerDeployment,
+	std::optional<size_t> _maxCodeSize
+):
 	m_ast(_ast),
 	m_recursiveFunctions(CallGraphGenerator::callGraph(_ast).recursiveFunctions()),
 	m_nameDispenser(_dispenser),
@@ -82,6 +105,13 @@ FullInliner::FullInliner(Block& _ast, NameDispenser& _dispenser, Dialect const&
 		updateCodeSize(fun);
 	}
 
+	size_t const codeSize = CodeSize::codeSizeIncludingFunctions(_ast);
+	size_t const codeSizeLimit =
+		_maxCodeSize ?
+		*_maxCodeSize :
+		maxCodeSize(codeSize, _expectedExecutionsPerDeployment);
+	m_growthBudget = codeSizeLimit - std::min(codeSize, codeSizeLimit);
+
 	// Check for memory guard.
 	if (auto const memoryGuard = m_dialect.findBuiltin("memoryguard"))
 	{
@@ -226,6 +256,9 @@ bool FullInliner::shallInline(FunctionCall const& _funCall, YulName _callSite)
 	if (m_singleUse.count(calledFunction->name))
 		return true;
 
+	if (size > m_growthBudget)
+		return false;
+
 	// Constant arguments might provide a means for further optimization, so they cause a bonus.
 	bool constantArg = false;
 	for (auto const& argument: _funCall.arguments)
@@ -243,7 +276,15 @@ bool FullInliner::shallInline(FunctionCall const& _funCall, YulName _callSite)
 
 void FullInliner::tentativelyUpdateCodeSize(YulName _function, YulName _callSite)
 {
-	m_functionSizes.at(_callSite) += m_functionSizes.at(_function);
+	size_t size = m_functionSizes.at(_function);
+	m_functionSizes.at(_callSite) += size;
+	if (growsCode(_function))
+		m_growthBudget -= std::min(size, m_growthBudget);
+}
+
+bool FullInliner::growsCode(YulName _function) const
+{
+	return m_functionSizes.at(_function) > 1 && !m_singleUse.count(_function);
 }
 
 void FullInliner::updateCodeSize(FunctionDefinition const& _fun)
@@ -317,6 +358,13 @@ std::vector<Statement> InlineModifier::performInline(Statement& _statement, Func
 		newStatements.emplace_back(std::move(varDecl));
 	};
 
+	// Declarations of parameters and return variables, the body and at most one
+	// statement per return variable to transfer its value.
+	newStatements.reserve(
+		function->parameters.size() +
+		2 * function->returnVariables.size() +
+		function->body.statements.size()
+	);
 	for (auto&& [parameter, argument]: ranges::views::zip(function->parameters, _funCall.arguments) | ranges::views::reverse)
 		newVariable(parameter, &argument);
 	for (auto const& var: function->returnVariables)
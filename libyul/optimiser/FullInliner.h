@@ -64,6 +64,12 @@ class NameCollector;
  * code of f, with replacements: a -> f_a, b -> f_b, c -> f_c
  * let z := f_c
  *
+ * Functions that are called more than once are only inlined as long as the code stays
+ * below a maximum size. Inside the optimiser suite, this maximum is derived once from the
+ * size of the code before optimisation (see @a maxCodeSize), so repeated runs cannot grow
+ * the code further and further. It is larger for code that is expected to be executed
+ * more often.
+ *
  * Prerequisites: Disambiguator
  * More efficient if run after: Function Hoister, Expression Splitter
  */
@@ -73,6 +79,10 @@ public:
 	static constexpr char const* name{"FullInliner"};
 	static void run(OptimiserStepContext& _context, Block& _ast);
 
+	/// @returns the size (as measured by @a CodeSize::codeSizeIncludingFunctions) that inlining
+	/// may grow code of size @a _codeSize to.
+	static size_t maxCodeSize(size_t _codeSize, std::optional<size_t> _expectedExecutionsPerDeployment);
+
 	/// Inlining heuristic.
 	/// @param _callSite the name of the function in which the function call is located.
 	bool shallInline(FunctionCall const& _funCall, YulName _callSite);
@@ -85,21 +95,35 @@ public:
 		return nullptr;
 	}
 
-	/// Adds the size of _funCall to the size of _callSite. This is just
-	/// a rough estimate that is done during inlining. The proper size
-	/// should be determined after inlining is completed.
+	/// Adds the size of _funCall to the size of _callSite and charges it to the
+	/// growth budget if needed. This is just a rough estimate that is done during
+	/// inlining. The proper size should be determined after inlining is completed.
 	void tentativelyUpdateCodeSize(YulName _function, YulName _callSite);
 
 private:
 	enum Pass { InlineTiny, InlineRest };
 
-	FullInliner(Block& _ast, NameDispenser& _dispenser, Dialect const& _dialect);
+	/// Minimum amount by which inlining may grow the code, so that the heuristic is not
+	/// restricted for small inputs.
+	static constexpr size_t MinimumGrowthBudget = 1000;
+
+	FullInliner(
+		Block& _ast,
+		NameDispenser& _dispenser,
+		Dialect const& _dialect,
+		std::optional<size_t> _expectedExecutionsPerDeployment,
+		std::optional<size_t> _maxCodeSize
+	);
 	void run(Pass _pass);
 
 	/// @returns a map containing the maximum depths of a call chain starting at each
 	/// function. For recursive functions, the value is one larger than for all others.
 	std::map<FunctionHandle, size_t> callDepths() const;
 
+	/// @returns true if inlining @a _function grows the code, i.e. if it is neither tiny
+	/// nor called only once (in which case it will be removed afterwards).
+	bool growsCode(YulName _function) const;
+
 	void updateCodeSize(FunctionDefinition const& _fun);
 	void handleBlock(YulName _currentFunctionName, Block& _block);
 	bool recursive(FunctionDefinition const& _fun) const;
@@ -120,6 +144,8 @@ private:
 	/// Variables that are constants (used for inlining heuristic)
 	std::set<YulName> m_constants;
 	std::map<YulName, size_t> m_functionSizes;
+	/// Remaining amount by which inlining may grow the code before it reaches its maximum size.
+	size_t m_growthBudget = 0;
 	NameDispenser& m_nameDispenser;
 	Dialect const& m_dialect;
 };
@@ -18,7 +18,7 @@
 
 #include <libyul/optimiser/LoopInvariantCodeMotion.h>
 
-#include <libyul/optimiser/CallGraphGenerator.h>
+#include <libyul/optimiser/AnalysisCache.h>
 #include <libyul/optimiser/NameCollector.h>
 #include <libyul/optimiser/Semantics.h>
 #include <libyul/optimiser/SSAValueTracker.h>
@@ -33,7 +33,7 @@ using namespace solidity::yul;
 void LoopInvariantCodeMotion::run(OptimiserStepContext& _context, Block& _ast)
 {
 	std::map<FunctionHandle, SideEffects> functionSideEffects =
-		SideEffectsPropagator::sideEffects(_context.dialect, CallGraphGenerator::callGraph(_ast));
+		AnalysisCache::functionSideEffects(_context, _ast);
 	bool containsMSize = MSizeFinder::containsMSize(_context.dialect, _ast);
 	std::set<YulName> ssaVars = SSAValueTracker::ssaVariables(_ast);
 	LoopInvariantCodeMotion{_context.dialect, ssaVars, functionSideEffects, containsMSize}(_ast);
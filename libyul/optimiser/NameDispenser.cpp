@@ -40,7 +40,7 @@ NameDispenser::NameDispenser(Dialect const& _dialect, Block const& _ast, std::se
 
 NameDispenser::NameDispenser(Dialect const& _dialect, std::set<YulName> _usedNames):
 	m_dialect(_dialect),
-	m_usedNames(std::move(_usedNames))
+	m_usedNames(_usedNames.begin(), _usedNames.end())
 {
 }
 
@@ -63,6 +63,8 @@ bool NameDispenser::illegalName(YulName _name)
 
 void NameDispenser::reset(Block const& _ast)
 {
-	m_usedNames = NameCollector(_ast).names() + m_reservedNames;
+	std::set<YulName> const usedNames = NameCollector(_ast).names();
+	m_usedNames = {usedNames.begin(), usedNames.end()};
+	m_usedNames.insert(m_reservedNames.begin(), m_reservedNames.end());
 	m_counter = 0;
 }
@@ -25,6 +25,7 @@
 #include <libyul/YulName.h>
 
 #include <set>
+#include <unordered_set>
 
 namespace solidity::yul
 {
@@ -51,7 +52,7 @@ public:
 	/// return it.
 	void markUsed(YulName _name) { m_usedNames.insert(_name); }
 
-	std::set<YulName> const& usedNames() { return m_usedNames; }
+	std::unordered_set<YulName> const& usedNames() { return m_usedNames; }
 
 	/// Returns true if `_name` is either used or is a restricted identifier.
 	bool illegalName(YulName _name);
@@ -62,7 +63,9 @@ public:
 
 private:
 	Dialect const& m_dialect;
-	std::set<YulName> m_usedNames;
+	/// Only used for membership tests, so a hash set suffices. Its iteration order
+	/// is not deterministic and must not influence the generated names.
+	std::unordered_set<YulName> m_usedNames;
 	std::set<YulName> m_reservedNames;
 	size_t m_counter = 0;
 };
@@ -30,6 +30,7 @@ namespace solidity::yul
 class Dialect;
 struct Block;
 class NameDispenser;
+class AnalysisCache;
 
 struct OptimiserStepContext
 {
@@ -38,6 +39,13 @@ struct OptimiserStepContext
 	std::set<YulName> const& reservedIdentifiers;
 	/// The value nullopt represents creation code
 	std::optional<size_t> expectedExecutionsPerDeployment;
+	/// Results of analyses shared between consecutive steps. Set only while @a OptimiserSuite runs
+	/// a sequence of steps. If null, steps compute the analyses they need from scratch.
+	AnalysisCache* analysisCache = nullptr;
+	/// Maximum code size that steps duplicating code, like the @a FullInliner, may grow the code to.
+	/// Set by @a OptimiserSuite from the size of the code before optimisation. If nullopt, the steps
+	/// derive it from the size of the code they are run on.
+	std::optional<size_t> maxCodeSize = std::nullopt;
 };
 
 
@@ -55,6 +63,10 @@ struct OptimiserStep
 	/// an SMT solver to be loaded, but none is available. In that case, the string
 	/// contains a human-readable reason.
 	virtual std::optional<std::string> invalidInCurrentEnvironment() const = 0;
+	/// @returns true if the step is guaranteed to keep the results of all analyses provided by
+	/// @a AnalysisCache unchanged, i.e. it neither adds, removes or renames functions nor changes
+	/// function calls or the control flow.
+	virtual bool preservesAnalyses() const = 0;
 	std::string name;
 };
 
@@ -73,6 +85,17 @@ private:
 		static constexpr bool value = decltype(test<T>(0))::value;
 	};
 
+	template<typename T>
+	struct HasPreservesAnalysesMember
+	{
+	private:
+		template<typename U> static auto test(int) -> decltype(U::preservesAnalyses, std::true_type());
+		template<typename> static std::false_type test(...);
+
+	public:
+		static constexpr bool value = decltype(test<T>(0))::value;
+	};
+
 public:
 	OptimiserStepInstance(): OptimiserStep{Step::name} {}
 	void run(OptimiserStepContext& _context, Block& _ast) const override
@@ -86,6 +109,13 @@ public:
 		else
 			return std::nullopt;
 	}
+	bool preservesAnalyses() const override
+	{
+		if constexpr (HasPreservesAnalysesMember<Step>::value)
+			return Step::preservesAnalyses;
+		else
+			return false;
+	}
 };
 
 
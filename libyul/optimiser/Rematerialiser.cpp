@@ -58,7 +58,7 @@ void Rematerialiser::visit(Expression& _e)
 		if (AssignedValue const* value = variableValue(name))
 		{
 			assertThrow(value->value, OptimizerException, "");
-			size_t refs = m_referenceCounts[name];
+			size_t refs = m_referenceCounts(name);
 			size_t cost = CodeCost::codeCost(m_dialect, *value->value);
 			if (
 				(
@@ -70,7 +70,7 @@ void Rematerialiser::visit(Expression& _e)
 				) || m_varsToAlwaysRematerialize.count(name)
 			)
 			{
-				assertThrow(m_referenceCounts[name] > 0, OptimizerException, "");
+				assertThrow(m_referenceCounts(name) > 0, OptimizerException, "");
 				auto variableReferences = sortedReferences(name);
 				if (!variableReferences || ranges::all_of(*variableReferences, [&](auto const& ref) { return inScope(ref); }))
 				{
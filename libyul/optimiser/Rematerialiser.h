@@ -23,6 +23,7 @@
 
 #include <libyul/optimiser/DataFlowAnalyzer.h>
 #include <libyul/optimiser/OptimiserStep.h>
+#include <libyul/DenseYulNameMap.h>
 
 namespace solidity::yul
 {
@@ -67,7 +68,7 @@ protected:
 	using ASTModifier::visit;
 	void visit(Expression& _e) override;
 
-	std::map<YulName, size_t> m_referenceCounts;
+	DenseYulNameMap<size_t> m_referenceCounts;
 	std::set<YulName> m_varsToAlwaysRematerialize;
 	bool m_onlySelectedVariables = false;
 };
@@ -85,6 +86,7 @@ class LiteralRematerialiser: public DataFlowAnalyzer
 {
 public:
 	static constexpr char const* name{"LiteralRematerialiser"};
+	static constexpr bool preservesAnalyses = true;
 	static void run(
 		OptimiserStepContext& _context,
 		Block& _ast
@@ -92,6 +92,7 @@ class SSATransform: public ASTModifier
 {
 public:
 	static constexpr char const* name{"SSATransform"};
+	static constexpr bool preservesAnalyses = true;
 	static void run(OptimiserStepContext& _context, Block& _ast);
 };
 
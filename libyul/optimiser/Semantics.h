@@ -115,10 +115,12 @@ public:
 
 	SideEffects sideEffects() { return m_sideEffects; }
 
+protected:
+	SideEffects m_sideEffects;
+
 private:
 	Dialect const& m_dialect;
 	std::map<FunctionHandle, SideEffects> const* m_functionSideEffects = nullptr;
-	SideEffects m_sideEffects;
 };
 
 /**
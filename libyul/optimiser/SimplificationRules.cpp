@@ -59,19 +59,44 @@ SimplificationRules::Rule const* SimplificationRules::findFirstMatch(
 	SimplificationRules& rules = *evmRules[version];
 	assertThrow(rules.isInitialized(), OptimizerException, "Rule list not properly initialized.");
 
-	for (auto const& rule: rules.m_rules[uint8_t(instruction->first)])
+	if (rules.m_rules.empty(instruction->first))
+		return nullptr;
+
+	// Describe the arguments the way the patterns see them, so that only rules
+	// that can possibly match are tried.
+	std::vector<SimplificationRuleArgument> arguments;
+	arguments.reserve(instruction->second->size());
+	for (Expression const& argument: *instruction->second)
 	{
-		rules.resetMatchGroups();
-		if (rule.pattern.matches(_expr, _dialect, _ssaValues))
-			if (!rule.feasible || rule.feasible())
-				return &rule;
+		// Patterns reject function calls as arguments, see Pattern::matches.
+		if (std::holds_alternative<FunctionCall>(argument))
+			return nullptr;
+
+		Expression const* value = &argument;
+		if (std::holds_alternative<Identifier>(argument))
+			if (AssignedValue const* assignedValue = _ssaValues(std::get<Identifier>(argument).name))
+				if (assignedValue->value)
+					value = assignedValue->value;
+
+		SimplificationRuleArgument& description = arguments.emplace_back();
+		if (std::holds_alternative<Literal>(*value) && std::get<Literal>(*value).kind == LiteralKind::Number)
+			description.kind = SimplificationRuleArgument::Kind::Constant;
+		else if (auto instrAndArgs = instructionAndArguments(_dialect, *value))
+		{
+			description.kind = SimplificationRuleArgument::Kind::Operation;
+			description.instruction = instrAndArgs->first;
+		}
 	}
-	return nullptr;
+
+	return rules.m_rules.findFirst(instruction->first, arguments, [&](Rule const& _rule) {
+		rules.resetMatchGroups();
+		return _rule.pattern.matches(_expr, _dialect, _ssaValues) && (!_rule.feasible || _rule.feasible());
+	});
 }
 
 bool SimplificationRules::isInitialized() const
 {
-	return !m_rules[uint8_t(evmasm::Instruction::ADD)].empty();
+	return !m_rules.empty(evmasm::Instruction::ADD);
 }
 
 std::optional<std::pair<evmasm::Instruction, std::vector<Expression> const*>>
@@ -94,7 +119,21 @@ void SimplificationRules::addRules(std::vector<Rule> const& _rules)
 
 void SimplificationRules::addRule(Rule const& _rule)
 {
-	m_rules[uint8_t(_rule.pattern.instruction())].push_back(_rule);
+	std::vector<std::optional<SimplificationRuleArgument>> arguments;
+	for (Pattern const& argument: _rule.pattern.arguments())
+		switch (argument.kind())
+		{
+		case PatternKind::Operation:
+			arguments.emplace_back(SimplificationRuleArgument{SimplificationRuleArgument::Kind::Operation, argument.instruction()});
+			break;
+		case PatternKind::Constant:
+			arguments.emplace_back(SimplificationRuleArgument{SimplificationRuleArgument::Kind::Constant});
+			break;
+		case PatternKind::Any:
+			arguments.emplace_back(std::nullopt);
+			break;
+		}
+	m_rules.addRule(_rule.pattern.instruction(), _rule, std::move(arguments));
 }
 
 SimplificationRules::SimplificationRules(std::optional<langutil::EVMVersion> _evmVersion)
@@ -83,7 +83,7 @@ private:
 	void resetMatchGroups() { m_matchGroups.clear(); }
 
 	std::map<unsigned, Expression const*> m_matchGroups;
-	std::vector<evmasm::SimplificationRule<Pattern>> m_rules[256];
+	evmasm::SimplificationRuleIndex<Pattern> m_rules;
 };
 
 enum class PatternKind
@@ -120,6 +120,7 @@ public:
 	/// same expression equivalence class.
 	void setMatchGroup(unsigned _group, std::map<unsigned, Expression const*>& _matchGroups);
 	unsigned matchGroup() const { return m_matchGroup; }
+	PatternKind kind() const { return m_kind; }
 	bool matches(
 		Expression const& _expr,
 		Dialect const& _dialect,
@@ -21,6 +21,7 @@
 
 #include <libyul/optimiser/Suite.h>
 
+#include <libyul/optimiser/ASTWalker.h>
 #include <libyul/optimiser/Disambiguator.h>
 #include <libyul/optimiser/VarDeclInitializer.h>
 #include <libyul/optimiser/BlockFlattener.h>
@@ -73,6 +74,7 @@
 
 #include <libsolutil/CommonData.h>
 #include <libsolutil/Profiler.h>
+#include <libsolutil/StringUtils.h>
 
 #include <libyul/CompilabilityChecker.h>
 
@@ -126,6 +128,11 @@ void OptimiserSuite::run(
 	// Some steps depend on properties ensured by FunctionHoister, BlockFlattener, FunctionGrouper and
 	// ForLoopInitRewriter. Run them first to be able to run arbitrary sequences safely.
 	suite.runSequence("hgfo", astRoot);
+	// Derive the maximum size once, so that the code cannot grow further with every round.
+	context.maxCodeSize = FullInliner::maxCodeSize(
+		CodeSize::codeSizeIncludingFunctions(astRoot),
+		_expectedExecutionsPerDeployment
+	);
 
 	// Now the user-supplied part
 	suite.runSequence(_optimisationSequence, astRoot);
@@ -222,6 +229,56 @@ std::map<std::string, std::unique_ptr<OptimiserStep>> optimiserStepCollection()
 	return ret;
 }
 
+/// Collects the code size of the body of every function, not counting the functions nested in it.
+class FunctionCodeSizes: public ASTWalker
+{
+public:
+	static std::map<std::string, size_t> run(Block const& _ast)
+	{
+		FunctionCodeSizes collector;
+		collector(_ast);
+		return std::move(collector.m_sizes);
+	}
+
+	using ASTWalker::operator();
+	void operator()(FunctionDefinition const& _function) override
+	{
+		m_sizes[_function.name.str()] = CodeSize::codeSize(_function.body);
+		ASTWalker::operator()(_function);
+	}
+
+private:
+	std::map<std::string, size_t> m_sizes;
+};
+
+/// Prints the code size and the functions that were added, removed or changed in size
+/// by a round of a repeated sequence and updates @a _functionSizes.
+void printConvergence(
+	size_t _round,
+	size_t _oldCodeSize,
+	size_t _newCodeSize,
+	std::map<std::string, size_t>& _functionSizes,
+	Block const& _ast
+)
+{
+	std::map<std::string, size_t> newFunctionSizes = FunctionCodeSizes::run(_ast);
+	std::vector<std::string> changedFunctions;
+	for (auto const& [name, size]: newFunctionSizes)
+		if (!_functionSizes.count(name) || _functionSizes.at(name) != size)
+			changedFunctions.emplace_back(name);
+	for (auto const& name: _functionSizes | ranges::views::keys)
+		if (!newFunctionSizes.count(name))
+			changedFunctions.emplace_back(name);
+
+	std::cout << "== Round " << _round + 1 << ": code size " << _oldCodeSize << " -> " << _newCodeSize << ", ";
+	std::cout << changedFunctions.size() << " of " << newFunctionSizes.size() << " functions changed";
+	if (!changedFunctions.empty())
+		std::cout << ": " << util::joinHumanReadable(changedFunctions);
+	std::cout << std::endl;
+
+	_functionSizes = std::move(newFunctionSizes);
+}
+
 }
 
 std::map<std::string, std::unique_ptr<OptimiserStep>> const& OptimiserSuite::allSteps()
@@ -445,6 +502,9 @@ void OptimiserSuite::runSequence(std::string_view _stepAbbreviations, Block& _as
 
 	// NOTE: If _repeatUntilStable is false, the value will not be used so do not calculate it.
 	size_t codeSize = (_repeatUntilStable ? CodeSize::codeSizeIncludingFunctions(_ast) : 0);
+	std::map<std::string, size_t> functionSizes;
+	if (_repeatUntilStable && m_debug == Debug::PrintConvergence)
+		functionSizes = FunctionCodeSizes::run(_ast);
 
 	for (size_t round = 0; round < MaxRounds; ++round)
 	{
@@ -460,9 +520,14 @@ void OptimiserSuite::runSequence(std::string_view _stepAbbreviations, Block& _as
 			break;
 
 		size_t newSize = CodeSize::codeSizeIncludingFunctions(_ast);
+		if (m_debug == Debug::PrintConvergence)
+			printConvergence(round, codeSize, newSize, functionSizes, _ast);
 		if (newSize == codeSize)
 			break;
 		codeSize = newSize;
+
+		if (m_debug == Debug::PrintConvergence && round + 1 == MaxRounds)
+			std::cout << "== Not stable after " << MaxRounds << " rounds." << std::endl;
 	}
 }
 
@@ -471,6 +536,10 @@ void OptimiserSuite::runSequence(std::vector<std::string> const& _steps, Block&
 	std::unique_ptr<Block> copy;
 	if (m_debug == Debug::PrintChanges)
 		copy = std::make_unique<Block>(std::get<Block>(ASTCopier{}(_ast)));
+
+	// The AST may have been modified since the last sequence was run, so nothing cached can be reused.
+	m_analysisCache.invalidate();
+	ScopedSaveAndRestore analysisCache(m_context.analysisCache, &m_analysisCache);
 	for (std::string const& step: _steps)
 	{
 		if (m_debug == Debug::PrintStep)
@@ -478,7 +547,10 @@ void OptimiserSuite::runSequence(std::vector<std::string> const& _steps, Block&
 
 		{
 			PROFILER_PROBE(step, probe);
-			allSteps().at(step)->run(m_context, _ast);
+			OptimiserStep const& optimiserStep = *allSteps().at(step);
+			optimiserStep.run(m_context, _ast);
+			if (!optimiserStep.preservesAnalyses())
+				m_analysisCache.invalidate();
 		}
 
 		if (m_debug == Debug::PrintChanges)
@@ -23,6 +23,7 @@
 
 #include <libyul/ASTForward.h>
 #include <libyul/YulName.h>
+#include <libyul/optimiser/AnalysisCache.h>
 #include <libyul/optimiser/OptimiserStep.h>
 #include <libyul/optimiser/NameDispenser.h>
 #include <liblangutil/EVMVersion.h>
@@ -57,7 +58,9 @@ public:
 	{
 		None,
 		PrintStep,
-		PrintChanges
+		PrintChanges,
+		/// Prints the code size and the functions that changed after every round of a repeated sequence.
+		PrintConvergence
 	};
 	OptimiserSuite(OptimiserStepContext& _context, Debug _debug = Debug::None): m_context(_context), m_debug(_debug) {}
 
@@ -90,6 +93,7 @@ public:
 private:
 	OptimiserStepContext& m_context;
 	Debug m_debug;
+	AnalysisCache m_analysisCache;
 };
 
 }
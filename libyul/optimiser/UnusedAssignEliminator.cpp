@@ -24,7 +24,7 @@
 
 #include <libyul/optimiser/Semantics.h>
 #include <libyul/optimiser/OptimizerUtilities.h>
-#include <libyul/ControlFlowSideEffectsCollector.h>
+#include <libyul/optimiser/AnalysisCache.h>
 #include <libyul/Utilities.h>
 #include <libyul/AST.h>
 #include <libyul/AsmPrinter.h>
@@ -42,7 +42,7 @@ void UnusedAssignEliminator::run(OptimiserStepContext& _context, Block& _ast)
 {
 	UnusedAssignEliminator uae{
 		_context.dialect,
-		ControlFlowSideEffectsCollector{_context.dialect, _ast}.functionSideEffectsNamed()
+		AnalysisCache::controlFlowSideEffects(_context, _ast)
 	};
 	uae(_ast);
 
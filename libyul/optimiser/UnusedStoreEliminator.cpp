@@ -28,7 +28,7 @@
 #include <libyul/optimiser/SSAValueTracker.h>
 #include <libyul/optimiser/DataFlowAnalyzer.h>
 #include <libyul/optimiser/KnowledgeBase.h>
-#include <libyul/ControlFlowSideEffectsCollector.h>
+#include <libyul/optimiser/AnalysisCache.h>
 #include <libyul/AST.h>
 #include <libyul/Utilities.h>
 
@@ -46,10 +46,7 @@ using namespace solidity::yul;
 
 void UnusedStoreEliminator::run(OptimiserStepContext& _context, Block& _ast)
 {
-	std::map<FunctionHandle, SideEffects> functionSideEffects = SideEffectsPropagator::sideEffects(
-		_context.dialect,
-		CallGraphGenerator::callGraph(_ast)
-	);
+	std::map<FunctionHandle, SideEffects> functionSideEffects = AnalysisCache::functionSideEffects(_context, _ast);
 
 	SSAValueTracker ssaValues;
 	ssaValues(_ast);
@@ -61,7 +58,7 @@ void UnusedStoreEliminator::run(OptimiserStepContext& _context, Block& _ast)
 	UnusedStoreEliminator rse{
 		_context.dialect,
 		functionSideEffects,
-		ControlFlowSideEffectsCollector{_context.dialect, _ast}.functionSideEffectsNamed(),
+		AnalysisCache::controlFlowSideEffects(_context, _ast),
 		values,
 		ignoreMemory
 	};
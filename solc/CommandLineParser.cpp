@@ -77,6 +77,7 @@ static std::string const g_strModelCheckerShowProvedSafe = "model-checker-show-p
 static std::string const g_strModelCheckerShowUnproved = "model-checker-show-unproved";
 static std::string const g_strModelCheckerShowUnsupported = "model-checker-show-unsupported";
 static std::string const g_strModelCheckerSolvers = "model-checker-solvers";
+static std::string const g_strModelCheckerSolverWorkers = "model-checker-solver-workers";
 static std::string const g_strModelCheckerTargets = "model-checker-targets";
 static std::string const g_strModelCheckerTimeout = "model-checker-timeout";
 static std::string const g_strModelCheckerBMCLoopIterations = "model-checker-bmc-loop-iterations";
@@ -913,6 +914,12 @@ General Information)").c_str(),
 			po::value<std::string>()->value_name("cvc5,eld,z3,smtlib2")->default_value("z3"),
 			"Select model checker solvers."
 		)
+		(
+			g_strModelCheckerSolverWorkers.c_str(),
+			po::value<unsigned>()->value_name("n"),
+			("Set the maximum number of CHC queries that are solved concurrently, each by a separate solver process."
+			" Must be between 1 and " + std::to_string(ModelCheckerSettings::MaxSolverWorkers) + ". Default is 1.").c_str()
+		)
 		(
 			g_strModelCheckerTargets.c_str(),
 			po::value<std::string>()->value_name("default,all,constantCondition,underflow,overflow,divByZero,balance,assert,popEmptyArray,outOfBounds")->default_value("default"),
@@ -1043,6 +1050,7 @@ void CommandLineParser::processArgs()
 		{g_strModelCheckerShowUnproved, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerShowUnsupported, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerSolvers, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
+		{g_strModelCheckerSolverWorkers, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerTimeout, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerBMCLoopIterations, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerContracts, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
@@ -1450,6 +1458,18 @@ void CommandLineParser::processArgs()
 		m_options.modelChecker.settings.solvers = *solvers;
 	}
 
+	if (m_args.count(g_strModelCheckerSolverWorkers))
+	{
+		unsigned workers = m_args[g_strModelCheckerSolverWorkers].as<unsigned>();
+		if (workers == 0 || workers > ModelCheckerSettings::MaxSolverWorkers)
+			solThrow(
+				CommandLineValidationError,
+				"Invalid option for --" + g_strModelCheckerSolverWorkers + ": must be between 1 and " +
+				std::to_string(ModelCheckerSettings::MaxSolverWorkers)
+			);
+		m_options.modelChecker.settings.solverWorkers = workers;
+	}
+
 	if (m_args.count(g_strModelCheckerPrintQuery))
 		m_options.modelChecker.settings.printQuery = true;
 
@@ -1483,6 +1503,7 @@ void CommandLineParser::processArgs()
 		m_args.count(g_strModelCheckerShowUnproved) ||
 		m_args.count(g_strModelCheckerShowUnsupported) ||
 		m_args.count(g_strModelCheckerSolvers) ||
+		m_args.count(g_strModelCheckerSolverWorkers) ||
 		m_args.count(g_strModelCheckerTargets) ||
 		m_args.count(g_strModelCheckerTimeout);
 	m_options.output.viaIR = (m_args.count(g_strExperimentalViaIR) > 0 || m_args.count(g_strViaIR) > 0);
@@ -0,0 +1,103 @@
+#!/usr/bin/env bash
+
+#------------------------------------------------------------------------------
+# Bash script to benchmark the processing of large Standard JSON inputs.
+#
+# Builds an input embedding many copies of the local benchmark contracts (similar to
+# the flattened sources submitted to verification services) and measures the time and
+# peak memory solc needs to read it, with compilation stopped right after parsing.
+# ------------------------------------------------------------------------------
+# This file is part of solidity.
+#
+# solidity is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# solidity is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with solidity.  If not, see <http://www.gnu.org/licenses/>
+#
+# (c) 2025 solidity contributors.
+#------------------------------------------------------------------------------
+
+set -euo pipefail
+
+REPO_ROOT=$(cd "$(dirname "$0")/../../" && pwd)
+SOLIDITY_BUILD_DIR=${SOLIDITY_BUILD_DIR:-${REPO_ROOT}/build}
+
+# shellcheck source=scripts/common.sh
+source "${REPO_ROOT}/scripts/common.sh"
+# shellcheck source=scripts/common_cmdline.sh
+source "${REPO_ROOT}/scripts/common_cmdline.sh"
+
+(( $# <= 1 )) || fail "Too many arguments. Usage: standard-json.sh [<solc-path>]"
+
+solc="${1:-${SOLIDITY_BUILD_DIR}/solc/solc}"
+command_available "$solc" --version
+command_available "$(type -P time)" --version
+command_available jq --version
+
+output_dir=$(mktemp -d -t solc-benchmark-XXXXXX)
+
+function cleanup() {
+    rm -r "${output_dir}"
+    exit
+}
+
+trap cleanup SIGINT SIGTERM
+
+function benchmark_input {
+    local copies="$1"
+    local input_path="${output_dir}/input-${copies}.json"
+    local time_file="${output_dir}/time-and-status-${copies}.txt"
+
+    jq --null-input \
+        --argjson copies "$copies" \
+        --rawfile verifier "${REPO_ROOT}/test/benchmarks/verifier.sol" \
+        --rawfile optimizorclub "${REPO_ROOT}/test/benchmarks/OptimizorClub.sol" \
+        --rawfile chains "${REPO_ROOT}/test/benchmarks/chains.sol" \
+        '{
+            language: "Solidity",
+            sources: ([
+                range($copies) as $i | {
+                    "verifier_\($i).sol": {content: $verifier},
+                    "OptimizorClub_\($i).sol": {content: $optimizorclub},
+                    "chains_\($i).sol": {content: $chains}
+                }
+            ] | add),
+            settings: {stopAfter: "parsing", outputSelection: {}}
+        }' > "$input_path"
+
+    gnu_time_to_json_file "$time_file" \
+        "$solc" --standard-json "$input_path" \
+        > "${output_dir}/output-${copies}.json" \
+        2>> "${output_dir}/benchmark-warn-err.txt"
+
+    printf '| %7d | %7d MiB | %6.2f s | %9d MiB | %9d |\n' \
+        "$(( copies * 3 ))" \
+        "$(( $(wc -c < "$input_path") / 1024 / 1024 ))" \
+        "$(jq '(.user + .sys) * 100 | round / 100' "$time_file")" \
+        "$(jq '.mem / 1024 | round' "$time_file")" \
+        "$(jq '.exit' "$time_file")"
+}
+
+echo "| Sources | Input size |   Time   | Memory (peak) | Exit code |"
+echo "|--------:|-----------:|---------:|--------------:|----------:|"
+
+for copies in 100 500 2000
+do
+    benchmark_input "$copies"
+done
+
+echo
+echo "======================================================="
+echo "Warnings and errors generated during run:"
+echo "======================================================="
+echo "$(< "${output_dir}/benchmark-warn-err.txt")"
+
+cleanup
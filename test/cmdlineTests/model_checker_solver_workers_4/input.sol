@@ -0,0 +1,9 @@
+// SPDX-License-Identifier: GPL-3.0
+pragma solidity >=0.0;
+contract C {
+    function f(uint8 x) public pure {
+        assert(x >= 0);
+        assert(x != 7);
+        assert(x < 1000);
+    }
+}
@@ -406,6 +406,47 @@ BOOST_AUTO_TEST_CASE(immutable, *boost::unit_test::precondition(nonEOF()))
 	);
 }
 
+BOOST_AUTO_TEST_CASE(source_mapping)
+{
+	auto rootName = std::make_shared<std::string>("root.asm");
+	auto subName = std::make_shared<std::string>("sub.asm");
+	// Same name as the first source, but a different object.
+	auto rootNameCopy = std::make_shared<std::string>("root.asm");
+	auto unknownName = std::make_shared<std::string>("unknown.asm");
+	std::map<std::string, unsigned> indices = {
+		{ "root.asm", 0 },
+		{ "sub.asm", 1 }
+	};
+
+	auto item = [](AssemblyItem _item, SourceLocation const& _location) {
+		_item.setLocation(_location);
+		return _item;
+	};
+	AssemblyItem jumpIn = item(Instruction::JUMP, {10, 12, subName});
+	jumpIn.setJumpType(AssemblyItem::JumpType::IntoFunction);
+	AssemblyItem jumpOut = item(Instruction::JUMP, {10, 12, subName});
+	jumpOut.setJumpType(AssemblyItem::JumpType::OutOfFunction);
+
+	AssemblyItems items{
+		item(Instruction::ADD, {1, 3, rootName}),
+		item(Instruction::ADD, {1, 3, rootName}),
+		item(Instruction::ADD, {1, 3, rootNameCopy}),
+		item(Instruction::ADD, {1, 5, rootName}),
+		item(Instruction::ADD, {2, 6, rootName}),
+		item(Instruction::ADD, {2, 6, subName}),
+		jumpIn,
+		jumpOut,
+		item(Instruction::ADD, {-1, -1, nullptr}),
+		item(Instruction::ADD, {123456, 123500, unknownName}),
+		item(Instruction::ADD, {123456, 123500, rootName}),
+	};
+
+	BOOST_CHECK_EQUAL(
+		AssemblyItem::computeSourceMapping(items, indices),
+		"1:2:0:-:0;;;:4;2;::1;10:2::i;:::o;-1:-1:-1:-;123456:44;::0"
+	);
+}
+
 BOOST_AUTO_TEST_CASE(subobject_encode_decode)
 {
 	EVMVersion evmVersion = solidity::test::CommonOptions::get().evmVersion();
@@ -130,6 +130,38 @@ BOOST_AUTO_TEST_CASE(translateLineColumnToPosition)
 	BOOST_CHECK_EQUAL(toPosition(2, 2, "ABC\nDEF\nGHI\n"), 10);
 }
 
+BOOST_AUTO_TEST_CASE(translatePositionToLineColumn)
+{
+	auto const toLineColumn = [](CharStream const& _stream, int _position) {
+		LineColumn lineColumn = _stream.translatePositionToLineColumn(_position);
+		return std::make_pair(lineColumn.line, lineColumn.column);
+	};
+
+	CharStream const empty{"", "source"};
+	BOOST_CHECK(toLineColumn(empty, 0) == std::make_pair(0, 0));
+	BOOST_CHECK(toLineColumn(empty, 5) == std::make_pair(0, 0));
+
+	CharStream const stream{"ABC\nDEF\n\nGHI", "source"};
+	BOOST_CHECK(toLineColumn(stream, 0) == std::make_pair(0, 0));
+	BOOST_CHECK(toLineColumn(stream, 2) == std::make_pair(0, 2));
+	// A line feed belongs to the line it terminates.
+	BOOST_CHECK(toLineColumn(stream, 3) == std::make_pair(0, 3));
+	BOOST_CHECK(toLineColumn(stream, 4) == std::make_pair(1, 0));
+	BOOST_CHECK(toLineColumn(stream, 7) == std::make_pair(1, 3));
+	BOOST_CHECK(toLineColumn(stream, 8) == std::make_pair(2, 0));
+	BOOST_CHECK(toLineColumn(stream, 9) == std::make_pair(3, 0));
+	BOOST_CHECK(toLineColumn(stream, 12) == std::make_pair(3, 3));
+	// Positions past the end are clamped to the end.
+	BOOST_CHECK(toLineColumn(stream, 100) == std::make_pair(3, 3));
+
+	// Both translations are inverse to each other.
+	for (int position = 0; position <= static_cast<int>(stream.size()); ++position)
+		BOOST_CHECK_EQUAL(
+			stream.translateLineColumnToPosition(stream.translatePositionToLineColumn(position)),
+			position
+		);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
@@ -0,0 +1,166 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+/// Unit tests for libsolidity/ast/ASTArena.h
+
+#include <libsolidity/ast/ASTArena.h>
+
+#include <libsolidity/ast/AST.h>
+#include <libsolidity/parsing/Parser.h>
+
+#include <liblangutil/CharStream.h>
+#include <liblangutil/ErrorReporter.h>
+
+#include <test/Common.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <memory>
+
+using namespace solidity::langutil;
+
+namespace solidity::frontend::test
+{
+
+namespace
+{
+
+bool isAligned(void const* _pointer, size_t _alignment)
+{
+	return reinterpret_cast<std::uintptr_t>(_pointer) % _alignment == 0;
+}
+
+struct alignas(alignof(std::max_align_t)) MaxAligned
+{
+	char value = 0;
+};
+
+}
+
+BOOST_AUTO_TEST_SUITE(ASTArenaTest)
+
+BOOST_AUTO_TEST_CASE(alignment)
+{
+	ASTArena arena;
+	for (size_t alignment = 1; alignment <= alignof(std::max_align_t); alignment *= 2)
+	{
+		// A single byte in between makes the next allocation misaligned unless it is padded.
+		BOOST_REQUIRE(arena.allocate(1, 1));
+		void* pointer = arena.allocate(3, alignment);
+		BOOST_REQUIRE(pointer);
+		BOOST_CHECK(isAligned(pointer, alignment));
+	}
+
+	auto sharedArena = std::make_shared<ASTArena>();
+	makeInArena<char>(sharedArena, 'x');
+	auto object = makeInArena<MaxAligned>(sharedArena);
+	BOOST_CHECK(isAligned(object.get(), alignof(MaxAligned)));
+}
+
+BOOST_AUTO_TEST_CASE(consecutive_allocations_share_a_block)
+{
+	ASTArena arena;
+	BOOST_CHECK_EQUAL(arena.reservedSize(), 0);
+	auto* first = static_cast<std::byte*>(arena.allocate(16, 8));
+	size_t const blockSize = arena.reservedSize();
+	BOOST_CHECK(blockSize > 0);
+	auto* second = static_cast<std::byte*>(arena.allocate(16, 8));
+	BOOST_CHECK(second == first + 16);
+	BOOST_CHECK_EQUAL(arena.reservedSize(), blockSize);
+}
+
+BOOST_AUTO_TEST_CASE(large_allocations)
+{
+	ASTArena arena;
+	auto* small = static_cast<std::byte*>(arena.allocate(16, 8));
+	size_t const blockSize = arena.reservedSize();
+
+	// Larger than a regular block: gets a block of its own of exactly the requested size.
+	size_t const largeSize = 4 * blockSize + 1;
+	auto* large = static_cast<std::byte*>(arena.allocate(largeSize, 8));
+	BOOST_REQUIRE(large);
+	BOOST_CHECK(isAligned(large, 8));
+	BOOST_CHECK_EQUAL(arena.reservedSize(), blockSize + largeSize);
+	// The whole range is usable.
+	large[0] = std::byte{1};
+	large[largeSize - 1] = std::byte{2};
+
+	// The regular block is still used for the following small allocations.
+	auto* next = static_cast<std::byte*>(arena.allocate(16, 8));
+	BOOST_CHECK(next == small + 16);
+	BOOST_CHECK_EQUAL(arena.reservedSize(), blockSize + largeSize);
+
+	// Filling up the regular block starts a new one.
+	arena.allocate(blockSize, 1);
+	arena.allocate(1, 1);
+	BOOST_CHECK(arena.reservedSize() > 2 * blockSize + largeSize);
+}
+
+BOOST_AUTO_TEST_CASE(objects_keep_arena_alive)
+{
+	auto arena = std::make_shared<ASTArena>();
+	std::weak_ptr<ASTArena> weakArena = arena;
+	auto string = makeInArena<ASTString>(arena, std::string(100, 'a'));
+	auto vector = makeInArena<std::vector<ASTPointer<ASTString>>>(arena, 3, string);
+	arena.reset();
+
+	BOOST_CHECK(!weakArena.expired());
+	BOOST_CHECK_EQUAL(*vector->at(2), std::string(100, 'a'));
+	string.reset();
+	BOOST_CHECK(!weakArena.expired());
+	vector.reset();
+	BOOST_CHECK(weakArena.expired());
+}
+
+BOOST_AUTO_TEST_CASE(ast_outlives_parser)
+{
+	ErrorList errors;
+	ErrorReporter errorReporter(errors);
+	CharStream charStream(
+		"contract C { uint x; function f(uint a) public returns (uint) { x = a; return a + 1; } }",
+		""
+	);
+	ASTPointer<SourceUnit> sourceUnit;
+	{
+		Parser parser(
+			errorReporter,
+			solidity::test::CommonOptions::get().evmVersion(),
+			solidity::test::CommonOptions::get().eofVersion()
+		);
+		sourceUnit = parser.parse(charStream);
+	}
+	BOOST_REQUIRE(sourceUnit);
+	BOOST_REQUIRE(errors.empty());
+
+	// Only the nodes still hold the arena. Take an inner node and drop the rest of the tree.
+	auto contract = std::dynamic_pointer_cast<ContractDefinition>(sourceUnit->nodes().at(0));
+	BOOST_REQUIRE(contract);
+	sourceUnit.reset();
+
+	BOOST_CHECK_EQUAL(contract->name(), "C");
+	BOOST_REQUIRE_EQUAL(contract->definedFunctions().size(), 1);
+	FunctionDefinition const& function = *contract->definedFunctions().front();
+	BOOST_CHECK_EQUAL(function.name(), "f");
+	BOOST_CHECK_EQUAL(function.parameters().at(0)->name(), "a");
+	BOOST_CHECK_EQUAL(function.body().statements().size(), 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -22,6 +22,10 @@
 #include <test/Metadata.h>
 #include <test/Common.h>
 
+#include <libsolidity/ast/ASTJsonExporter.h>
+
+#include <libsolutil/JSON.h>
+
 #include <boost/test/unit_test.hpp>
 
 using namespace solidity::test;
@@ -70,6 +74,33 @@ BOOST_AUTO_TEST_CASE(does_not_include_creation_time_only_internal_functions, *bo
 	BOOST_CHECK(runtimeBytecode.size() <= 30);
 }
 
+BOOST_AUTO_TEST_CASE(workers_do_not_change_the_result)
+{
+	StringMap const sources{
+		{"a.sol", "pragma solidity >=0.0; import \"b.sol\"; contract A is B { function f() public pure override returns (uint) { return 1; } }"},
+		{"b.sol", "pragma solidity >=0.0; abstract contract B { function f() public pure virtual returns (uint); }"},
+		{"c.sol", "pragma solidity >=0.0; contract C { function g() public pure returns (uint r) { return 2; r = 3; } }"},
+		{"d.sol", "pragma solidity >=0.0; contract D { function h() public pure returns (uint r) { if (r == 0) revert(); r; } }"},
+	};
+	auto run = [&](size_t _workers) {
+		CompilerStack compiler;
+		compiler.setEVMVersion(solidity::test::CommonOptions::get().evmVersion());
+		compiler.setWorkers(_workers);
+		compiler.setSources(sources);
+		BOOST_REQUIRE(compiler.parseAndAnalyze());
+		std::string result;
+		for (auto const& error: compiler.errors())
+			result += langutil::Error::formatErrorType(error->type()) + ": " + *error->comment() + "\n";
+		for (auto const& [name, source]: sources)
+			result += util::jsonCompactPrint(ASTJsonExporter(compiler.state()).toJson(compiler.ast(name))) + "\n";
+		return result;
+	};
+
+	std::string const sequential = run(1);
+	BOOST_CHECK(sequential.find("Unreachable code") != std::string::npos);
+	BOOST_CHECK_EQUAL(run(4), sequential);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
@@ -245,6 +245,40 @@ BOOST_AUTO_TEST_CASE(encoded_sizes)
 	BOOST_CHECK_EQUAL(twoDimArray.calldataEncodedSize(false), 9 * 3 * 32);
 }
 
+BOOST_AUTO_TEST_CASE(interned_types)
+{
+	ArrayType const* uintArray = TypeProvider::array(DataLocation::Memory, TypeProvider::uint256());
+	BOOST_CHECK(uintArray == TypeProvider::array(DataLocation::Memory, TypeProvider::uint256()));
+	BOOST_CHECK(uintArray != TypeProvider::array(DataLocation::Storage, TypeProvider::uint256()));
+	BOOST_CHECK(TypeProvider::array(DataLocation::Memory, uintArray, 3) == TypeProvider::array(DataLocation::Memory, uintArray, 3));
+	BOOST_CHECK(TypeProvider::array(DataLocation::Memory, uintArray, 3) != TypeProvider::array(DataLocation::Memory, uintArray, 4));
+
+	ReferenceType const* uintArrayInStorage = TypeProvider::withLocation(uintArray, DataLocation::Storage, true);
+	BOOST_CHECK(uintArrayInStorage == TypeProvider::withLocation(uintArray, DataLocation::Storage, true));
+	BOOST_CHECK(uintArrayInStorage != TypeProvider::withLocation(uintArray, DataLocation::Storage, false));
+
+	BOOST_CHECK(
+		TypeProvider::tuple({TypeProvider::uint256(), uintArray}) ==
+		TypeProvider::tuple({TypeProvider::uint256(), uintArray})
+	);
+
+	// Types that only differ in names are equal, but still distinct instances.
+	MappingType const* mapping = TypeProvider::mapping(TypeProvider::address(), "owner", TypeProvider::uint256(), "balance");
+	BOOST_CHECK(mapping == TypeProvider::mapping(TypeProvider::address(), "owner", TypeProvider::uint256(), "balance"));
+	MappingType const* unnamedMapping = TypeProvider::mapping(TypeProvider::address(), "", TypeProvider::uint256(), "");
+	BOOST_CHECK(mapping != unnamedMapping);
+	BOOST_CHECK(*mapping == *unnamedMapping);
+
+	BOOST_CHECK(
+		TypeProvider::function(strings{"uint256"}, strings{}, FunctionType::Kind::Internal) ==
+		TypeProvider::function(strings{"uint256"}, strings{}, FunctionType::Kind::Internal)
+	);
+	BOOST_CHECK(
+		TypeProvider::function(strings{"uint256"}, strings{}, FunctionType::Kind::Internal) !=
+		TypeProvider::function(strings{"uint256"}, strings{}, FunctionType::Kind::External)
+	);
+}
+
 BOOST_AUTO_TEST_CASE(helper_bool_result)
 {
 	BoolResult r1{true};
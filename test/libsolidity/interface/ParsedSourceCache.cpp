@@ -0,0 +1,155 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+/// Unit tests for libsolidity/interface/ParsedSourceCache.h
+
+#include <libsolidity/interface/ParsedSourceCache.h>
+
+#include <libsolidity/ast/AST.h>
+#include <libsolidity/ast/ASTJsonExporter.h>
+#include <libsolidity/interface/CompilerStack.h>
+
+#include <libsolutil/JSON.h>
+#include <libsolutil/Keccak256.h>
+
+#include <test/Common.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <memory>
+
+using namespace solidity::langutil;
+
+namespace solidity::frontend::test
+{
+
+namespace
+{
+
+struct CompilationResult
+{
+	SourceUnit const* a;
+	SourceUnit const* b;
+	std::string astJson;
+	bytes bytecode;
+	size_t warningCount;
+};
+
+CompilationResult compile(std::shared_ptr<ParsedSourceCache> _cache, std::string const& _sourceB)
+{
+	CompilerStack compiler;
+	compiler.setEVMVersion(solidity::test::CommonOptions::get().evmVersion());
+	compiler.setParsedSourceCache(std::move(_cache));
+	compiler.setSources({
+		{"a.sol", "pragma solidity >=0.0; contract A { function f() public pure returns (uint) { return 1; } }"},
+		{"b.sol", _sourceB},
+	});
+	BOOST_REQUIRE(compiler.compile());
+
+	size_t warningCount = 0;
+	for (auto const& error: compiler.errors())
+		if (error->type() == Error::Type::Warning)
+			++warningCount;
+
+	return {
+		&compiler.ast("a.sol"),
+		&compiler.ast("b.sol"),
+		util::jsonCompactPrint(ASTJsonExporter(compiler.state()).toJson(compiler.ast("b.sol"))),
+		compiler.object("B").bytecode,
+		warningCount
+	};
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(ParsedSourceCacheTest)
+
+BOOST_AUTO_TEST_CASE(reuses_unchanged_sources)
+{
+	std::string const sourceB = "import \"a.sol\"; contract B is A { function g() public pure returns (uint) { return f() + 1; } }";
+	auto cache = std::make_shared<ParsedSourceCache>();
+
+	CompilationResult const uncached = compile(nullptr, sourceB);
+	CompilationResult const first = compile(cache, sourceB);
+	BOOST_CHECK_EQUAL(cache->size(), 2);
+	CompilationResult const second = compile(cache, sourceB);
+
+	BOOST_CHECK(second.a == first.a);
+	BOOST_CHECK(second.b == first.b);
+	BOOST_CHECK_EQUAL(second.astJson, uncached.astJson);
+	BOOST_CHECK(second.bytecode == uncached.bytecode);
+	// The missing SPDX license identifier is reported by the parser and must be reported on a cache hit too.
+	BOOST_CHECK_EQUAL(second.warningCount, uncached.warningCount);
+	BOOST_CHECK_EQUAL(first.warningCount, uncached.warningCount);
+}
+
+BOOST_AUTO_TEST_CASE(reparses_modified_sources)
+{
+	auto cache = std::make_shared<ParsedSourceCache>();
+
+	CompilationResult const first = compile(cache, "import \"a.sol\"; contract B is A {}");
+	CompilationResult const second = compile(cache, "import \"a.sol\"; contract B is A { uint x; }");
+
+	BOOST_CHECK(second.a == first.a);
+	BOOST_CHECK(second.b != first.b);
+	BOOST_CHECK_EQUAL(cache->size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(does_not_store_experimental_sources)
+{
+	auto cache = std::make_shared<ParsedSourceCache>();
+	CompilerStack compiler;
+	compiler.setEVMVersion(solidity::test::CommonOptions::get().evmVersion());
+	compiler.setParsedSourceCache(cache);
+	compiler.setSources({
+		{"a.sol", "pragma experimental solidity;"},
+		{"b.sol", "pragma solidity >=0.0; contract B {}"},
+	});
+	BOOST_REQUIRE(compiler.parse());
+	BOOST_REQUIRE(compiler.ast("a.sol").experimentalSolidity());
+
+	BOOST_CHECK_EQUAL(cache->size(), 1);
+	ParsedSourceCache::Settings const settings{solidity::test::CommonOptions::get().evmVersion(), std::nullopt};
+	BOOST_CHECK(!cache->lookup("a.sol", util::keccak256("pragma experimental solidity;"), settings));
+	BOOST_CHECK(cache->lookup("b.sol", util::keccak256("pragma solidity >=0.0; contract B {}"), settings));
+}
+
+BOOST_AUTO_TEST_CASE(moves_reused_sources_to_new_node_ids)
+{
+	auto compileWithPrefix = [](std::shared_ptr<ParsedSourceCache> _cache, bool _withPrefix) {
+		CompilerStack compiler;
+		compiler.setEVMVersion(solidity::test::CommonOptions::get().evmVersion());
+		compiler.setParsedSourceCache(std::move(_cache));
+		StringMap sources{{"b.sol", "pragma solidity >=0.0; contract B { uint x; function f() public { x = 1; } }"}};
+		if (_withPrefix)
+			// Sorts before b.sol, so b.sol gets node IDs following the ones of this source.
+			sources["a.sol"] = "pragma solidity >=0.0; contract A { function g() public pure {} }";
+		compiler.setSources(std::move(sources));
+		BOOST_REQUIRE(compiler.parseAndAnalyze());
+		return util::jsonCompactPrint(ASTJsonExporter(compiler.state()).toJson(compiler.ast("b.sol")));
+	};
+
+	auto cache = std::make_shared<ParsedSourceCache>();
+	compileWithPrefix(cache, false);
+	BOOST_CHECK_EQUAL(compileWithPrefix(cache, true), compileWithPrefix(nullptr, true));
+	BOOST_CHECK_EQUAL(compileWithPrefix(cache, false), compileWithPrefix(nullptr, false));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
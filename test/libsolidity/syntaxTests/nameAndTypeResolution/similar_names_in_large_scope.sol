@@ -0,0 +1,87 @@
+contract C {
+    uint bdksgmrr;
+    uint bmwmkr;
+    uint bpsdwmz;
+    uint cdttdld;
+    uint cflcsclcg;
+    uint csbnnldzg;
+    uint dckwtp;
+    uint dgzmrg;
+    uint dhhgbgvgw;
+    uint dhvsmgtmt;
+    uint dmbdmdldm;
+    uint dmlklvws;
+    uint drbpvvbs;
+    uint dsznln;
+    uint dvpzzk;
+    uint fclkmcfzv;
+    uint ffwvwwndg;
+    uint fwsckdkvh;
+    uint gbdmth;
+    uint ggbbfzgt;
+    uint gscdfrcz;
+    uint gtfsvpdlt;
+    uint gvlfswhl;
+    uint gzzbvhb;
+    uint hgwfcpz;
+    uint kbmknzl;
+    uint knfgrg;
+    uint knglss;
+    uint knnzknv;
+    uint kwnznv;
+    uint lslkzwr;
+    uint lzbdmdg;
+    uint mbvdzdzdw;
+    uint mchmgtms;
+    uint mngbwcwm;
+    uint mrbmcbb;
+    uint mtgcrvzt;
+    uint pcfbgf;
+    uint pmwhzb;
+    uint pvndfzthp;
+    uint pwgngcztz;
+    uint rfsvcbl;
+    uint rpgzcvsss;
+    uint rpplcnkr;
+    uint rrdlflwkp;
+    uint slgdhgll;
+    uint srbvrhfw;
+    uint tgfnhfkr;
+    uint tzsptkr;
+    uint vbptmg;
+    uint vddmwdcnv;
+    uint vfkndwbnv;
+    uint vhhmvb;
+    uint vrnlhldnz;
+    uint vzwzlzmk;
+    uint wbwrdfs;
+    uint whmnbg;
+    uint whtpdsv;
+    uint wnckdg;
+    uint wtcdppr;
+    uint zlfhmc;
+    uint znklpkgsr;
+    uint znzdflfd;
+    uint zrgbznd;
+    uint zrhrlzpl;
+    uint zvmskk;
+    uint zwlvftw;
+    uint zwpdmch;
+    uint zzbldbc;
+    uint totalSupplyOfTokensHeldInReserveAccounts;
+    function f() public view returns (uint r) {
+        r = cdttdlx;
+        r = dmbdmdld;
+        r = gscxdfrczy;
+        r = paengcztz;
+        r = totalSupplyOfTokenHeldInReserveAccount;
+        r = qqqqqqq;
+    }
+}
+// ----
+// DeclarationError 7576: (1401-1408): Undeclared identifier. Did you mean "cdttdld"?
+// DeclarationError 7576: (1422-1430): Undeclared identifier. Did you mean "dmbdmdldm"?
+// DeclarationError 7576: (1444-1454): Undeclared identifier. Did you mean "gscdfrcz"?
+// DeclarationError 7576: (1468-1477): Undeclared identifier. Did you mean "pwgngcztz"?
+// DeclarationError 7576: (1491-1529): Undeclared identifier. Did you mean "totalSupplyOfTokensHeldInReserveAccounts"?
+// DeclarationError 7576: (1543-1550): Undeclared identifier.
@@ -166,6 +166,22 @@ BOOST_AUTO_TEST_CASE(parse_json_strict)
 	BOOST_CHECK(json[0] == "\xF0\x9F\x98\x8A");
 }
 
+BOOST_AUTO_TEST_CASE(parse_json_strict_raw_newlines_and_tabs)
+{
+	Json json;
+	std::string errors;
+
+	// Newlines and tabs outside of string literals are just whitespace.
+	BOOST_CHECK(jsonParseStrict("{\n\t\"a\": \"b\"\n}", json, &errors));
+	BOOST_CHECK(json["a"] == "b");
+
+	// Raw newlines and tabs within string literals are accepted for backwards-compatibility.
+	BOOST_CHECK(jsonParseStrict("{\"a\": \"x\ny\tz\", \"b\": \"\\\"\n\", \"c\": \"\\\\\"}", json, &errors));
+	BOOST_CHECK(json["a"] == "x\ny\tz");
+	BOOST_CHECK(json["b"] == "\"\n");
+	BOOST_CHECK(json["c"] == "\\");
+}
+
 BOOST_AUTO_TEST_CASE(json_isOfType)
 {
 	Json json;
@@ -0,0 +1,93 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the parallel execution helpers.
+ */
+
+#include <libsolutil/Parallel.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace solidity::util::test
+{
+
+BOOST_AUTO_TEST_SUITE(ParallelTest)
+
+BOOST_AUTO_TEST_CASE(no_tasks)
+{
+	for (size_t workers: {0u, 1u, 4u})
+		parallelFor(0, workers, [](size_t) { BOOST_REQUIRE(false); });
+}
+
+BOOST_AUTO_TEST_CASE(every_index_visited_once)
+{
+	for (size_t workers: {0u, 1u, 2u, 8u, 100u})
+	{
+		std::vector<std::atomic<size_t>> visits(37);
+		parallelFor(visits.size(), workers, [&](size_t _index) { ++visits[_index]; });
+		for (auto const& count: visits)
+			BOOST_CHECK_EQUAL(count.load(), 1);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(results_by_index)
+{
+	std::vector<size_t> squares(100);
+	parallelFor(squares.size(), 4, [&](size_t _index) { squares[_index] = _index * _index; });
+	for (size_t i = 0; i < squares.size(); ++i)
+		BOOST_CHECK_EQUAL(squares[i], i * i);
+}
+
+BOOST_AUTO_TEST_CASE(sequential_order)
+{
+	std::vector<size_t> order;
+	parallelFor(5, 1, [&](size_t _index) { order.push_back(_index); });
+	std::vector<size_t> expectation(5);
+	std::iota(expectation.begin(), expectation.end(), 0);
+	BOOST_CHECK_EQUAL_COLLECTIONS(order.begin(), order.end(), expectation.begin(), expectation.end());
+}
+
+BOOST_AUTO_TEST_CASE(lowest_exception_rethrown)
+{
+	std::atomic<size_t> finished = 0;
+	try
+	{
+		parallelFor(20, 4, [&](size_t _index) {
+			if (_index == 7 || _index == 13)
+				throw std::runtime_error(std::to_string(_index));
+			++finished;
+		});
+		BOOST_FAIL("Expected an exception.");
+	}
+	catch (std::runtime_error const& _error)
+	{
+		BOOST_CHECK_EQUAL(std::string(_error.what()), "7");
+	}
+	// A failing task does not prevent the remaining ones from running.
+	BOOST_CHECK_EQUAL(finished.load(), 18);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -0,0 +1,76 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for DenseYulNameMap.
+ */
+
+#include <libyul/DenseYulNameMap.h>
+
+#include <boost/test/unit_test.hpp>
+
+namespace solidity::yul::test
+{
+
+BOOST_AUTO_TEST_SUITE(DenseYulNameMapTest)
+
+BOOST_AUTO_TEST_CASE(absent_names)
+{
+	DenseYulNameMap<size_t> map;
+	BOOST_CHECK_EQUAL(map(YulName{"dense_map_absent"}), 0);
+
+	map[YulName{"dense_map_present"}] = 2;
+	BOOST_CHECK_EQUAL(map(YulName{"dense_map_present"}), 2);
+	BOOST_CHECK_EQUAL(map(YulName{"dense_map_absent"}), 0);
+	BOOST_CHECK_EQUAL(map(YulName{"dense_map_created_later"}), 0);
+}
+
+BOOST_AUTO_TEST_CASE(from_map)
+{
+	YulName a{"dense_map_a"};
+	YulName b{"dense_map_b"};
+	YulName c{"dense_map_c"};
+	DenseYulNameMap<size_t> map({{a, 1}, {c, 3}});
+	BOOST_CHECK_EQUAL(map(a), 1);
+	BOOST_CHECK_EQUAL(map(b), 0);
+	BOOST_CHECK_EQUAL(map(c), 3);
+
+	map[b] += 2;
+	map[c]--;
+	BOOST_CHECK_EQUAL(map(a), 1);
+	BOOST_CHECK_EQUAL(map(b), 2);
+	BOOST_CHECK_EQUAL(map(c), 2);
+}
+
+BOOST_AUTO_TEST_CASE(grows_in_both_directions)
+{
+	YulName first{"dense_map_first"};
+	YulName middle{"dense_map_middle"};
+	YulName last{"dense_map_last"};
+
+	DenseYulNameMap<size_t> map;
+	map[middle] = 2;
+	map[last] = 3;
+	map[first] = 1;
+	BOOST_CHECK_EQUAL(map(first), 1);
+	BOOST_CHECK_EQUAL(map(middle), 2);
+	BOOST_CHECK_EQUAL(map(last), 3);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
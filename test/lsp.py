@@ -1871,6 +1871,60 @@ class SolidityLSPTestSuite: # {{{
         self.expect_equal(reports[0]['uri'], f'{self.project_root_uri}/goto/lib.sol', "")
         self.expect_equal(len(reports[0]['diagnostics']), 0, "should not contain diagnostics")
 
+    def test_semanticTokens_rereads_closed_files(self, solc: JsonRpcProcess) -> None:
+        """
+        Requests that do not modify any source reuse the previous compilation,
+        unless they refer to a file that is not open and that may have changed on disk.
+        """
+
+        self.setup_lsp(solc)
+        LIB_PATH = f'{self.project_root_dir}/semantic_tokens_closed_lib.sol'
+        LIB_URI = PurePath(LIB_PATH).as_uri()
+        FILE_A_URI = f'{self.project_root_uri}/a.sol'
+
+        def write_lib(body: str) -> None:
+            with open(LIB_PATH, mode='w', encoding='utf-8', newline='') as f:
+                f.write(
+                    '// SPDX-License-Identifier: UNLICENSED\n'
+                    'pragma solidity >=0.8.0;\n'
+                    f'contract L {{ function f() public pure {{ {body} }} }}\n'
+                )
+
+        def semantic_tokens(uri: str) -> list:
+            reply = solc.call_method('textDocument/semanticTokens/full', {'textDocument': {'uri': uri}})
+            self.expect_true('result' in reply, "semantic tokens are returned")
+            return reply['result']['data']
+
+        write_lib('uint x;')
+        try:
+            solc.send_message('textDocument/didOpen', {
+                'textDocument': {
+                    'uri': FILE_A_URI,
+                    'languageId': 'Solidity',
+                    'version': 1,
+                    'text':
+                        '// SPDX-License-Identifier: UNLICENSED\n'
+                        'pragma solidity >=0.8.0;\n'
+                        'import "./semantic_tokens_closed_lib.sol";\n'
+                        'contract A is L {}\n'
+                }
+            })
+            reports = self.wait_for_diagnostics(solc)
+            self.expect_equal(len(reports), 2, "diagnostics for both files")
+
+            # Nothing changed, so the previous compilation is reused and gives the same result.
+            tokens_a = semantic_tokens(FILE_A_URI)
+            self.expect_equal(semantic_tokens(FILE_A_URI), tokens_a, "same tokens for unchanged file")
+
+            tokens_lib = semantic_tokens(LIB_URI)
+            write_lib('uint x; uint y;')
+            self.expect_true(
+                len(semantic_tokens(LIB_URI)) > len(tokens_lib),
+                "file that is not open is read from disk again"
+            )
+        finally:
+            os.remove(LIB_PATH)
+
     def test_textDocument_didChange_at_eol(self, solc: JsonRpcProcess) -> None:
         """
         Append at one line and insert a new one below.
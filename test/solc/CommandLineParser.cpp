@@ -153,6 +153,7 @@ BOOST_AUTO_TEST_CASE(cli_mode_options)
 			"--model-checker-show-unproved",
 			"--model-checker-show-unsupported",
 			"--model-checker-solvers=z3,smtlib2",
+			"--model-checker-solver-workers=4",
 			"--model-checker-targets=underflow,divByZero",
 			"--model-checker-timeout=5"
 		};
@@ -223,6 +224,7 @@ BOOST_AUTO_TEST_CASE(cli_mode_options)
 			true,
 			true,
 			{false, false, true, true},
+			4,
 			{{VerificationTargetType::Underflow, VerificationTargetType::DivByZero}},
 			5,
 		};
@@ -104,6 +104,7 @@ void FuzzerUtil::testCompiler(
 			/*showUnproved=*/false,
 			/*showUnsupported=*/false,
 			smtutil::SMTSolverChoice::All(),
+			/*solverWorkers=*/1,
 			frontend::ModelCheckerTargets::Default(),
 			/*timeout=*/1
 		});
@@ -175,11 +175,11 @@ public:
 		m_nameDispenser.reset(*m_astRoot);
 	}
 
-	void runSteps(std::string _source, std::string _steps)
+	void runSteps(std::string _source, std::string _steps, OptimiserSuite::Debug _debug = OptimiserSuite::Debug::None)
 	{
 		parse(_source);
 		disambiguate();
-		OptimiserSuite{m_context}.runSequence(_steps, *m_astRoot);
+		OptimiserSuite{m_context, _debug}.runSequence(_steps, *m_astRoot);
 		std::cout << AsmPrinter{m_dialect}(*m_astRoot) << std::endl;
 	}
 
@@ -259,6 +259,7 @@ int main(int argc, char** argv)
 	try
 	{
 		bool nonInteractive = false;
+		bool printConvergence = false;
 		po::options_description options(
 			R"(yulopti, yul optimizer exploration tool.
 	Usage: yulopti [Options] <file>
@@ -286,6 +287,11 @@ int main(int argc, char** argv)
 				po::bool_switch(&nonInteractive)->default_value(false),
 				"stop after executing the provided steps"
 			)
+			(
+				"print-convergence",
+				po::bool_switch(&printConvergence)->default_value(false),
+				"print the code size and the changed functions after every round of the bracketed parts of --steps"
+			)
 			("help,h", "Show this help screen.");
 
 		// All positional options should be interpreted as input files
@@ -337,7 +343,11 @@ int main(int argc, char** argv)
 			std::string sequence = arguments["steps"].as<std::string>();
 			if (!nonInteractive)
 				std::cout << "----------------------" << std::endl;
-			yulOpti.runSteps(input, sequence);
+			yulOpti.runSteps(
+				input,
+				sequence,
+				printConvergence ? OptimiserSuite::Debug::PrintConvergence : OptimiserSuite::Debug::None
+			);
 			disambiguated = true;
 		}
 		if (!nonInteractive)